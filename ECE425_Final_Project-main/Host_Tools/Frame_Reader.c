@@ -0,0 +1,78 @@
+/**
+ * @file Frame_Reader.c
+ *
+ * @brief Source code for the Frame_Reader module of the host tools.
+ *
+ * This file contains the function definitions for the Frame_Reader module.
+ * The COBS decoder and the CRC are the ones of the firmware, built from the Snake_Game directory.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Frame_Reader.h"
+#include "COBS.h"
+#include "CRC16.h"
+
+void Frame_Reader_Init(Frame_Reader *reader)
+{
+	reader->length = 0;
+	reader->overflow = 0;
+	reader->bad_frames = 0;
+}
+
+Frame_Status Frame_Reader_Push(Frame_Reader *reader, uint8_t byte, uint8_t *message, uint16_t *length)
+{
+	if (byte != 0x00)
+	{
+		// The rest of a frame that is too long is dropped up to the next delimiter
+		if (reader->length == FRAME_MAX_ENCODED)
+		{
+			reader->overflow = 1;
+			return FRAME_NONE;
+		}
+		reader->encoded[reader->length++] = byte;
+		return FRAME_NONE;
+	}
+
+	uint16_t encoded_length = reader->length;
+	uint8_t overflow = reader->overflow;
+	reader->length = 0;
+	reader->overflow = 0;
+
+	if (encoded_length == 0 && !overflow)
+	{
+		return FRAME_NONE;
+	}
+
+	uint16_t decoded_length;
+	if (overflow || !COBS_Decode(reader->encoded, encoded_length, message, &decoded_length) || decoded_length < 3)
+	{
+		reader->bad_frames++;
+		return FRAME_BAD;
+	}
+
+	decoded_length -= 2;
+	uint16_t crc = CRC16_Update(CRC16_INITIAL, message, decoded_length);
+	if (message[decoded_length] != (crc & 0xFF) || message[decoded_length + 1] != (crc >> 8))
+	{
+		reader->bad_frames++;
+		return FRAME_BAD;
+	}
+
+	*length = decoded_length;
+	return FRAME_OK;
+}
+
+Frame_Status Frame_Read(Frame_Reader *reader, FILE *stream, uint8_t *message, uint16_t *length)
+{
+	int c;
+	while ((c = fgetc(stream)) != EOF)
+	{
+		Frame_Status status = Frame_Reader_Push(reader, (uint8_t)c, message, length);
+		if (status != FRAME_NONE)
+		{
+			return status;
+		}
+	}
+	return FRAME_END;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file Frame_Reader.h
+ *
+ * @brief Header code for the Frame_Reader module of the host tools.
+ *
+ * This file contains the function definitions for the Frame_Reader module.
+ * It splits the serial stream of the firmware at each 0x00 byte, COBS-decodes each frame,
+ * and checks the CRC-16/CCITT-FALSE in its last two bytes (low byte first). This is the framing
+ * of the Game_Protocol, Telemetry, and Event_Trace messages, so every host tool reads the stream
+ * through this module.
+ *
+ * The bytes are pushed one at a time, so the same reader is used on a file, on a serial device,
+ * and on the bytes that a test captures from the firmware.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef frame_reader_header
+#define frame_reader_header
+#include <stdint.h>
+#include <stdio.h>
+
+// The largest encoded frame: a keyframe of the large board is about 1110 bytes
+#define FRAME_MAX_ENCODED 2048
+
+typedef enum
+{
+	FRAME_NONE,
+	FRAME_OK,
+	FRAME_BAD,
+	FRAME_END
+} Frame_Status;
+
+typedef struct
+{
+	uint8_t encoded[FRAME_MAX_ENCODED];
+	uint16_t length;
+	uint8_t overflow;
+	uint32_t bad_frames;
+} Frame_Reader;
+
+/**
+ * @brief The Frame_Reader_Init function empties the reader and clears its count of bad frames.
+ *
+ * @param reader The reader.
+ *
+ * @return None
+ */
+void Frame_Reader_Init(Frame_Reader *reader);
+
+/**
+ * @brief The Frame_Reader_Push function adds one byte of the stream.
+ *
+ * @param reader The reader.
+ * @param byte The byte.
+ * @param message The buffer that receives the message, without the CRC. It must hold
+ * FRAME_MAX_ENCODED bytes.
+ * @param length Receives the length of the message, without the CRC.
+ *
+ * @return FRAME_OK if the byte ended a valid frame; FRAME_BAD if it ended a frame that is too long,
+ * is not valid COBS, or fails the CRC; FRAME_NONE otherwise. An empty frame (two 0x00 bytes in
+ * a row) is not counted as bad.
+ */
+Frame_Status Frame_Reader_Push(Frame_Reader *reader, uint8_t byte, uint8_t *message, uint16_t *length);
+
+/**
+ * @brief The Frame_Read function reads a stream until the end of the next frame.
+ *
+ * @param reader The reader.
+ * @param stream The stream.
+ * @param message The buffer that receives the message, as in Frame_Reader_Push.
+ * @param length Receives the length of the message.
+ *
+ * @return FRAME_OK or FRAME_BAD as in Frame_Reader_Push, or FRAME_END at the end of the stream.
+ */
+Frame_Status Frame_Read(Frame_Reader *reader, FILE *stream, uint8_t *message, uint16_t *length);
+#endif
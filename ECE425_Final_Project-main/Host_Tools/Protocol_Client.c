@@ -0,0 +1,256 @@
+/**
+ * @file Protocol_Client.c
+ *
+ * @brief Source code for the Protocol_Client module of the host tools.
+ *
+ * This file contains the function definitions for the Protocol_Client module.
+ * The layout of each message is described in the header code of the Game_Protocol driver.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Protocol_Client.h"
+#include "Game_Protocol.h"
+#include <string.h>
+
+// Type, sequence number, and the keyframe header before the walls
+#define KEYFRAME_HEADER_LENGTH (2 + 13)
+
+// Marks a repeat of the previous row in the compressed walls (LEVEL_RUN_REPEAT of Level_Pack)
+#define WALLS_RUN_REPEAT 0xFF
+
+static uint16_t Read_U16(const uint8_t *bytes)
+{
+	return bytes[0] | (bytes[1] << 8);
+}
+
+static bool Cell_On_Board(const Protocol_Board *board, uint8_t x, uint8_t y)
+{
+	return x < board->width && y < board->height;
+}
+
+// Decodes one row of runs into row y, and returns the number of bytes read, or 0 if the runs do
+// not add up to the width of the board
+static uint16_t Decode_Walls_Row(Protocol_Board *board, const uint8_t *runs, uint16_t size, uint8_t y)
+{
+	uint16_t index = 0;
+	uint16_t x = 0;
+	bool wall = false;
+	while (x < board->width)
+	{
+		if (index == size || x + runs[index] > board->width)
+		{
+			return 0;
+		}
+		for (uint8_t i = 0; i < runs[index]; i++)
+		{
+			board->walls[y * board->width + x + i] = wall;
+		}
+		x += runs[index++];
+		wall = !wall;
+	}
+	return index;
+}
+
+// Decodes the compressed walls of a level, which must cover the board exactly
+static bool Decode_Walls(Protocol_Board *board, const uint8_t *runs, uint16_t size)
+{
+	uint16_t index = 0;
+	uint16_t row = 0;
+	uint8_t y = 0;
+	while (y < board->height)
+	{
+		if (index < size && runs[index] == WALLS_RUN_REPEAT)
+		{
+			if (y == 0 || index + 1 == size || y + runs[index + 1] > board->height)
+			{
+				return false;
+			}
+			for (uint8_t copy = 0; copy < runs[index + 1]; copy++)
+			{
+				Decode_Walls_Row(board, &runs[row], size - row, y++);
+			}
+			index += 2;
+		}
+		else
+		{
+			uint16_t used = Decode_Walls_Row(board, &runs[index], size - index, y);
+			if (used == 0)
+			{
+				return false;
+			}
+			row = index;
+			index += used;
+			y++;
+		}
+	}
+	return index == size;
+}
+
+static bool Apply_Keyframe(Protocol_Board *board, const uint8_t *message, uint16_t length)
+{
+	if (length < KEYFRAME_HEADER_LENGTH)
+	{
+		return false;
+	}
+
+	uint8_t width = message[2];
+	uint8_t height = message[3];
+	uint8_t walls_size = message[14];
+	uint16_t cell_count = width * height;
+	if (cell_count == 0 || cell_count > PROTOCOL_CLIENT_MAX_CELLS
+		|| length != KEYFRAME_HEADER_LENGTH + walls_size + (cell_count + 7) / 8)
+	{
+		return false;
+	}
+
+	board->width = width;
+	board->height = height;
+	if (!Decode_Walls(board, &message[KEYFRAME_HEADER_LENGTH], walls_size))
+	{
+		// The walls are partly written, so the board waits for the next keyframe
+		board->synchronized = false;
+		return false;
+	}
+	board->score = Read_U16(&message[4]);
+	board->direction = message[6];
+	board->food_x = message[7];
+	board->food_y = message[8];
+
+	// The food y is the height of the board when the snake fills it
+	board->food_placed = Cell_On_Board(board, board->food_x, board->food_y);
+	board->length = Read_U16(&message[9]);
+	board->head_x = message[11];
+	board->head_y = message[12];
+	board->level = message[13];
+
+	const uint8_t *bitmap = &message[KEYFRAME_HEADER_LENGTH + walls_size];
+	for (uint16_t cell = 0; cell < cell_count; cell++)
+	{
+		board->cells[cell] = (bitmap[cell >> 3] >> (cell & 0x07)) & 1;
+	}
+
+	board->synchronized = true;
+	board->game_over = false;
+	return true;
+}
+
+static bool Apply_Delta(Protocol_Board *board, const uint8_t *message, uint16_t length)
+{
+	if (length < 5)
+	{
+		return false;
+	}
+
+	uint8_t flags = message[2];
+	uint8_t head_x = message[3];
+	uint8_t head_y = message[4];
+	uint16_t index = 5;
+
+	uint16_t expected = index;
+	expected += (flags & PROTOCOL_DELTA_TAIL_VACATED) ? 2 : 0;
+	expected += (flags & PROTOCOL_DELTA_FOOD_MOVED) ? 2 : 0;
+	expected += (flags & PROTOCOL_DELTA_SCORE_CHANGED) ? 2 : 0;
+	if (length != expected || !Cell_On_Board(board, head_x, head_y))
+	{
+		return false;
+	}
+
+	// The tail is cleared first, since the head can move into the cell that the tail leaves
+	if (flags & PROTOCOL_DELTA_TAIL_VACATED)
+	{
+		uint8_t tail_x = message[index++];
+		uint8_t tail_y = message[index++];
+		if (!Cell_On_Board(board, tail_x, tail_y))
+		{
+			return false;
+		}
+		board->cells[tail_y * board->width + tail_x] = 0;
+	}
+	else
+	{
+		board->length++;
+	}
+
+	board->cells[head_y * board->width + head_x] = 1;
+	board->head_x = head_x;
+	board->head_y = head_y;
+
+	if (flags & PROTOCOL_DELTA_FOOD_MOVED)
+	{
+		board->food_x = message[index++];
+		board->food_y = message[index++];
+		board->food_placed = Cell_On_Board(board, board->food_x, board->food_y);
+	}
+
+	if (flags & PROTOCOL_DELTA_SCORE_CHANGED)
+	{
+		board->score = Read_U16(&message[index]);
+	}
+	return true;
+}
+
+void Protocol_Client_Init(Protocol_Board *board)
+{
+	memset(board, 0, sizeof(*board));
+}
+
+bool Protocol_Client_Apply(Protocol_Board *board, const uint8_t *message, uint16_t length)
+{
+	if (length < 2)
+	{
+		return false;
+	}
+
+	uint8_t type = message[0];
+	uint8_t sequence = message[1];
+
+	// A skipped sequence number means that a message was lost
+	if (sequence != board->next_sequence)
+	{
+		board->synchronized = false;
+	}
+	board->next_sequence = sequence + 1;
+
+	bool applied = false;
+	switch (type)
+	{
+		case PROTOCOL_MSG_KEYFRAME:
+		{
+			applied = Apply_Keyframe(board, message, length);
+			break;
+		}
+
+		case PROTOCOL_MSG_DELTA:
+		{
+			if (board->synchronized)
+			{
+				applied = Apply_Delta(board, message, length);
+			}
+			break;
+		}
+
+		case PROTOCOL_MSG_GAME_OVER:
+		{
+			if (length == 4)
+			{
+				board->score = Read_U16(&message[2]);
+				board->game_over = true;
+				applied = true;
+			}
+			break;
+		}
+
+		default:
+		{
+			break;
+		}
+	}
+
+	if (!applied && type == PROTOCOL_MSG_DELTA)
+	{
+		board->synchronized = false;
+		board->dropped_deltas++;
+	}
+	return applied;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Protocol_Client.h
+ *
+ * @brief Header code for the Protocol_Client module of the host tools.
+ *
+ * This file contains the function definitions for the Protocol_Client module.
+ * It rebuilds the board from the messages of the Game_Protocol driver of the firmware. The size of
+ * the board is taken from each keyframe, so the same client reads the small and the large board.
+ *
+ * A delta is only applied to the board of the message before it. When a sequence number is
+ * skipped, the deltas are dropped until the next keyframe, which the firmware sends every
+ * PROTOCOL_KEYFRAME_INTERVAL ticks. A frame that fails its CRC is not counted as a lost message,
+ * since the text that the firmware prints between messages also fails it.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef protocol_client_header
+#define protocol_client_header
+#include <stdint.h>
+#include <stdbool.h>
+
+// Enough for the large board (128 x 64)
+#define PROTOCOL_CLIENT_MAX_CELLS 8192
+
+typedef struct
+{
+	uint8_t width;
+	uint8_t height;
+	uint16_t score;
+	uint8_t direction;
+	uint8_t food_x;
+	uint8_t food_y;
+	bool food_placed;
+	uint16_t length;
+	uint8_t head_x;
+	uint8_t head_y;
+
+	uint8_t level;
+
+	// One byte per cell, row by row: 1 for the snake, 0 otherwise
+	uint8_t cells[PROTOCOL_CLIENT_MAX_CELLS];
+
+	// One byte per cell, row by row: 1 for a wall of the level, 0 otherwise
+	uint8_t walls[PROTOCOL_CLIENT_MAX_CELLS];
+
+	bool synchronized;
+	bool game_over;
+	uint8_t next_sequence;
+	uint32_t dropped_deltas;
+} Protocol_Board;
+
+/**
+ * @brief The Protocol_Client_Init function clears the board. Deltas are dropped until the
+ * first keyframe.
+ *
+ * @param board The board.
+ *
+ * @return None
+ */
+void Protocol_Client_Init(Protocol_Board *board);
+
+/**
+ * @brief The Protocol_Client_Apply function applies a message whose CRC is already checked.
+ *
+ * The message of a delta is applied in this order:
+ *  1. The vacated tail cell is cleared.
+ *  2. The head cell is set.
+ *  3. The food and the score are updated.
+ * The head can move into the cell that the tail leaves on the same tick, so the head must be set
+ * after the tail is cleared.
+ *
+ * @param board The board.
+ * @param message The message, without the CRC.
+ * @param length The length of the message.
+ *
+ * @return True if the board changed; false if the message was dropped.
+ */
+bool Protocol_Client_Apply(Protocol_Board *board, const uint8_t *message, uint16_t length);
+#endif
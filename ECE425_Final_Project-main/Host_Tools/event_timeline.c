@@ -0,0 +1,223 @@
+/**
+ * @file event_timeline.c
+ *
+ * @brief Host decoder for the event trace dump of the Snake game.
+ *
+ * This program reads the chunks that the events command of the Debug_Console sends on UART0, and
+ * prints one line per event, oldest first, with its time in us since the first event of the dump.
+ * The layout of the chunks and the events is described in the header code of the Event_Trace driver.
+ *
+ * The times are taken from the difference between two events, so the DWT cycle count can wrap
+ * within a dump. A key event can be earlier than the event before it, since it has the time at
+ * which the key was received by the interrupt.
+ *
+ * Usage:
+ *  event_timeline [-w width] [file]
+ * The stream is read from the file, or from the standard input, and can hold the text of the
+ * terminal around the dump. The width of the board (20, or 128 when LARGE_BOARD is 1) is used to
+ * print the cells as x and y.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Frame_Reader.h"
+#include "Event_Trace.h"
+#include "Profiler.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define EVENT_BYTES 8
+
+static Frame_Reader reader;
+static uint8_t message[FRAME_MAX_ENCODED];
+
+static char *direction_names[4] = {"UP", "DOWN", "LEFT", "RIGHT"};
+static char *source_names[2] = {"UART", "button"};
+
+static unsigned int board_width = 20;
+
+// Time of the last event, in cycles since the first event of the dump
+static int64_t last_time;
+static uint32_t last_cycles;
+static uint32_t events_printed;
+
+static void Print_Cell(char *label, uint16_t cell)
+{
+	printf("%s (%u, %u)", label, cell % board_width, cell / board_width);
+}
+
+static void Print_Direction(uint8_t direction)
+{
+	printf("%-6s", direction < 4 ? direction_names[direction] : "?");
+}
+
+static void Print_Event(const uint8_t *event)
+{
+	uint32_t cycles = event[0] | (event[1] << 8) | (event[2] << 16) | ((uint32_t)event[3] << 24);
+	uint8_t type = event[4];
+	uint8_t data = event[5];
+	uint16_t value = event[6] | (event[7] << 8);
+
+	if (events_printed != 0)
+	{
+		last_time += (int32_t)(cycles - last_cycles);
+	}
+	last_cycles = cycles;
+	events_printed++;
+
+	printf("%12.2f us  ", (double)last_time / PROFILER_CYCLES_PER_US);
+	switch (type)
+	{
+		case EVENT_TRACE_GAME_START:
+		{
+			printf("GAME_START  ");
+			Print_Cell("head", value);
+			break;
+		}
+
+		case EVENT_TRACE_KEY:
+		{
+			printf("KEY         ");
+			if (data >= ' ' && data < 0x7F)
+			{
+				printf("'%c'", data);
+			}
+			else
+			{
+				printf("0x%02X", data);
+			}
+			printf(" from %s", value < 2 ? source_names[value] : "?");
+			break;
+		}
+
+		case EVENT_TRACE_DIRECTION:
+		{
+			printf("DIRECTION   ");
+			Print_Direction(data);
+			Print_Cell(" head", value);
+			break;
+		}
+
+		case EVENT_TRACE_MOVE:
+		{
+			printf("MOVE        ");
+			Print_Direction(data);
+			Print_Cell(" head", value);
+			break;
+		}
+
+		case EVENT_TRACE_GROW:
+		{
+			printf("GROW        length %u", value);
+			break;
+		}
+
+		case EVENT_TRACE_FOOD:
+		{
+			printf("FOOD        ");
+			Print_Cell("food", value);
+			break;
+		}
+
+		case EVENT_TRACE_COLLISION:
+		{
+			printf("COLLISION   ");
+			Print_Direction(data);
+			Print_Cell(" head", value);
+			break;
+		}
+
+		case EVENT_TRACE_OVERRUN:
+		{
+			printf("OVERRUN     work %u0 us", value);
+			break;
+		}
+
+		default:
+		{
+			printf("type 0x%02X  data 0x%02X  value %u", type, data, value);
+			break;
+		}
+	}
+	printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *stream = stdin;
+	int argument = 1;
+	if (argc > 2 && strcmp(argv[1], "-w") == 0)
+	{
+		board_width = atoi(argv[2]);
+		argument = 3;
+	}
+	if (board_width == 0)
+	{
+		fprintf(stderr, "Usage: event_timeline [-w width] [file]\n");
+		return 1;
+	}
+	if (argc > argument)
+	{
+		stream = fopen(argv[argument], "rb");
+		if (stream == NULL)
+		{
+			perror(argv[argument]);
+			return 1;
+		}
+	}
+
+	Frame_Reader_Init(&reader);
+
+	// The chunk expected next, and the number of chunks of the dump being read
+	uint32_t next_chunk = 0;
+	uint32_t chunk_count = 0;
+
+	Frame_Status status;
+	uint16_t length;
+	while ((status = Frame_Read(&reader, stream, message, &length)) != FRAME_END)
+	{
+		if (status != FRAME_OK || length < 4 || message[0] != EVENT_TRACE_MSG_DUMP
+			|| length != 4 + (message[3] * EVENT_BYTES))
+		{
+			continue;
+		}
+
+		uint8_t chunk_index = message[1];
+
+		// Chunk 0 starts a new dump, whose times start again from 0
+		if (chunk_index == 0)
+		{
+			if (next_chunk != chunk_count)
+			{
+				printf("Dump ended after %" PRIu32 " of %" PRIu32 " chunks\n", next_chunk, chunk_count);
+			}
+			chunk_count = message[2];
+			next_chunk = 0;
+			last_time = 0;
+			events_printed = 0;
+			printf("Dump of %" PRIu32 " chunks\n", chunk_count);
+		}
+
+		// The times stay right over a missing chunk, since the events are less than 86 seconds apart
+		if (chunk_index > next_chunk)
+		{
+			printf("Chunks %" PRIu32 " to %u of %u missing\n", next_chunk, chunk_index - 1, message[2]);
+			chunk_count = message[2];
+		}
+		next_chunk = chunk_index + 1;
+
+		for (uint8_t i = 0; i < message[3]; i++)
+		{
+			Print_Event(&message[4 + (i * EVENT_BYTES)]);
+		}
+	}
+
+	if (next_chunk != chunk_count)
+	{
+		printf("Dump ended after %" PRIu32 " of %" PRIu32 " chunks\n", next_chunk, chunk_count);
+	}
+	fprintf(stderr, "%" PRIu32 " bad frames\n", reader.bad_frames);
+	return 0;
+}
@@ -0,0 +1,373 @@
+/**
+ * @file level_walls_gen.c
+ *
+ * @brief Generator of the compressed walls of the levels of the Snake game.
+ *
+ * The walls of each level are drawn below as a text map, '#' for a wall and '.' for a free cell.
+ * This program compresses each map into the runs of the Level_Pack driver (see Level_Pack.h), and
+ * writes Level_Walls.h of the firmware, with each map in a comment above its runs. The runs are
+ * decoded again and compared with the map before they are written.
+ *
+ * Usage:
+ *  make levels     Writes ../Snake_Game/Level_Walls.h after a map is changed
+ *  make test       Also checks that Level_Walls.h matches the maps
+ *
+ * The open level has no map, since its walls are the same on both boards (see Level_Pack.c).
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Level_Pack.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MAP_MAX_ROWS 16
+#define MAP_MAX_CELLS (128 * 64)
+
+typedef struct
+{
+	const char *name;
+	const char *rows[MAP_MAX_ROWS];
+} Level_Map;
+
+typedef struct
+{
+	// Size of the maps in characters, and the size of a character in cells
+	uint8_t width;
+	uint8_t height;
+	uint8_t scale;
+	const Level_Map *maps;
+} Board;
+
+// Maps of the Box, Pillars, and Corridors levels, in the order of levels[] in Level_Pack.c
+#define LEVEL_MAP_COUNT 3
+
+static const Level_Map small_maps[LEVEL_MAP_COUNT] =
+{
+	{"box",
+	{
+		"....................",
+		"....................",
+		"..######....######..",
+		"..#..............#..",
+		"..#..............#..",
+		"....................",
+		"..#..............#..",
+		"..######....######..",
+		"....................",
+		"...................."
+	}},
+	{"pillars",
+	{
+		"....................",
+		"....................",
+		"...##....##....##...",
+		"...##....##....##...",
+		"....................",
+		"....................",
+		"...##....##....##...",
+		"...##....##....##...",
+		"....................",
+		"...................."
+	}},
+	{"corridors",
+	{
+		"....................",
+		".##################.",
+		"....................",
+		"....................",
+		".#######....#######.",
+		"....................",
+		"....................",
+		".##################.",
+		"....................",
+		"...................."
+	}}
+};
+
+static const Level_Map large_maps[LEVEL_MAP_COUNT] =
+{
+	{"box",
+	{
+		"................................",
+		"................................",
+		"....##########....##########....",
+		"....#......................#....",
+		"....#......................#....",
+		"....#......................#....",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		"....#......................#....",
+		"....#......................#....",
+		"....#......................#....",
+		"....##########....##########....",
+		"................................",
+		"................................"
+	}},
+	{"pillars",
+	{
+		"................................",
+		"................................",
+		"...##.....##.....##.....##......",
+		"...##.....##.....##.....##......",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		"...##.....##.....##.....##......",
+		"...##.....##.....##.....##......",
+		"................................",
+		"................................"
+	}},
+	{"corridors",
+	{
+		"................................",
+		".##############################.",
+		"................................",
+		"................................",
+		"................................",
+		".############.....#############.",
+		"................................",
+		"................................",
+		"................................",
+		"................................",
+		".############.....#############.",
+		"................................",
+		"................................",
+		"................................",
+		".##############################.",
+		"................................"
+	}}
+};
+
+static const Board small_board = {20, 10, 1, small_maps};
+static const Board large_board = {32, 16, 4, large_maps};
+
+static uint8_t runs[256];
+static uint8_t decoded[MAP_MAX_CELLS];
+
+// Writes the runs of one row of the map, and returns the number of runs
+static uint16_t Encode_Row(const Board *board, const char *row, uint8_t *out)
+{
+	uint16_t count = 0;
+	uint16_t run = 0;
+	bool wall = false;
+	for (uint8_t x = 0; x < board->width; x++)
+	{
+		if ((row[x] == '#') != wall)
+		{
+			out[count++] = run;
+			run = 0;
+			wall = !wall;
+		}
+		run += board->scale;
+	}
+	out[count++] = run;
+	return count;
+}
+
+// Compresses a map into runs, and returns the number of bytes, or 0 if the map is not valid
+static uint16_t Encode_Map(const Board *board, const Level_Map *map)
+{
+	uint16_t size = 0;
+	uint8_t y = 0;
+	while (y < board->height)
+	{
+		if (map->rows[y] == NULL || strlen(map->rows[y]) != board->width
+			|| strspn(map->rows[y], ".#") != board->width)
+		{
+			fprintf(stderr, "Row %u of the %s map is not %u characters of '.' and '#'\n", y, map->name, board->width);
+			return 0;
+		}
+
+		// The same rows that follow are sent as one repeat
+		uint8_t same = 1;
+		while (y + same < board->height && map->rows[y + same] != NULL
+			&& strcmp(map->rows[y + same], map->rows[y]) == 0)
+		{
+			same++;
+		}
+
+		size += Encode_Row(board, map->rows[y], &runs[size]);
+		uint16_t repeat = (same * board->scale) - 1;
+		if (repeat != 0)
+		{
+			runs[size++] = LEVEL_RUN_REPEAT;
+			runs[size++] = repeat;
+		}
+		y += same;
+	}
+	return size;
+}
+
+// Decodes the runs of one row into row y of decoded, and returns the index after the runs
+static uint16_t Decode_Row(uint16_t width, uint16_t index, uint16_t y)
+{
+	uint16_t x = 0;
+	bool wall = false;
+	while (x < width)
+	{
+		uint16_t run = runs[index++];
+		if (run > width - x)
+		{
+			run = width - x;
+		}
+		memset(&decoded[(y * width) + x], wall, run);
+		x += run;
+		wall = !wall;
+	}
+	return index;
+}
+
+// Decodes the runs the way Level_Load does, and compares the cells with the map
+static bool Check_Map(const Board *board, const Level_Map *map, uint16_t size)
+{
+	uint16_t width = board->width * board->scale;
+	uint16_t height = board->height * board->scale;
+	uint16_t index = 0;
+	uint16_t row = 0;
+	uint16_t y = 0;
+	while (y < height && index < size)
+	{
+		if (runs[index] == LEVEL_RUN_REPEAT)
+		{
+			for (uint8_t copy = 0; copy < runs[index + 1] && y < height; copy++)
+			{
+				Decode_Row(width, row, y++);
+			}
+			index += 2;
+		}
+		else
+		{
+			row = index;
+			index = Decode_Row(width, row, y++);
+		}
+	}
+
+	if (y != height || index != size)
+	{
+		return false;
+	}
+	for (y = 0; y < height; y++)
+	{
+		for (uint16_t x = 0; x < width; x++)
+		{
+			bool wall = map->rows[y / board->scale][x / board->scale] == '#';
+			if (decoded[(y * width) + x] != wall)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static bool Write_Board(const Board *board)
+{
+	for (uint8_t level = 0; level < LEVEL_MAP_COUNT; level++)
+	{
+		const Level_Map *map = &board->maps[level];
+		uint16_t size = Encode_Map(board, map);
+		if (size == 0)
+		{
+			return false;
+		}
+		if (size > LEVEL_MAX_WALLS_SIZE)
+		{
+			fprintf(stderr, "The %s map takes %u bytes, more than LEVEL_MAX_WALLS_SIZE\n", map->name, size);
+			return false;
+		}
+		if (!Check_Map(board, map, size))
+		{
+			fprintf(stderr, "The runs of the %s map do not decode to the map\n", map->name);
+			return false;
+		}
+
+		printf("/*\n");
+		for (uint8_t y = 0; y < board->height; y++)
+		{
+			printf(" * %s\n", map->rows[y]);
+		}
+		printf(" */\n");
+		printf("static const uint8_t level_%s_walls[] =\n{\n", map->name);
+
+		// One line per row of the map, with its repeat
+		uint16_t index = 0;
+		while (index < size)
+		{
+			uint16_t end = index;
+			uint16_t x = 0;
+			while (x < board->width * board->scale)
+			{
+				x += runs[end++];
+			}
+			if (end < size && runs[end] == LEVEL_RUN_REPEAT)
+			{
+				end += 2;
+			}
+
+			printf("\t");
+			for (uint16_t i = index; i < end; i++)
+			{
+				if (runs[i] == LEVEL_RUN_REPEAT && i + 1 < end)
+				{
+					printf("0xFF");
+				}
+				else
+				{
+					printf("%u", runs[i]);
+				}
+				printf((i + 1 < end) ? ", " : "");
+			}
+			printf((end < size) ? ",\n" : "\n");
+			index = end;
+		}
+		printf("};\n");
+		if (level + 1 < LEVEL_MAP_COUNT)
+		{
+			printf("\n");
+		}
+	}
+	return true;
+}
+
+int main(void)
+{
+	printf("/**\n");
+	printf(" * @file Level_Walls.h\n");
+	printf(" *\n");
+	printf(" * @brief Compressed walls of the levels of the Level_Pack driver.\n");
+	printf(" *\n");
+	printf(" * This file is written by level_walls_gen in Host_Tools from the maps in level_walls_gen.c.\n");
+	printf(" * Do not edit it; change the maps and run make levels in Host_Tools instead. make test checks\n");
+	printf(" * that this file matches the maps. It is only included by Level_Pack.c.\n");
+	printf(" *\n");
+	printf(" * On the large board, each character of a map is a block of 4 x 4 cells.\n");
+	printf(" *\n");
+	printf(" * @author Samira Cordero-Morales\n");
+	printf(" */\n");
+	printf("\n");
+	printf("#ifndef level_walls_header\n");
+	printf("#define level_walls_header\n");
+	printf("#include <stdint.h>\n");
+	printf("\n");
+	printf("#if LARGE_BOARD\n");
+	if (!Write_Board(&large_board))
+	{
+		return 1;
+	}
+	printf("#else\n");
+	if (!Write_Board(&small_board))
+	{
+		return 1;
+	}
+	printf("#endif\n");
+	printf("#endif\n");
+	return 0;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file snake_client.c
+ *
+ * @brief Host renderer for the binary output mode of the Snake game.
+ *
+ * This program reads the Game_Protocol messages of the firmware, rebuilds the board from the
+ * keyframes and the deltas, and draws it in the terminal with ANSI escape sequences.
+ * The walls of the level come with each keyframe, and are drawn as '#' like in the text mode.
+ *
+ * Usage:
+ *  snake_client [file]
+ * The stream is read from the file, or from the standard input. On Linux, the serial port of the
+ * LaunchPad can be read directly after it is set to raw mode:
+ *  stty -F /dev/ttyACM0 115200 raw -echo
+ *  ./snake_client /dev/ttyACM0
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Frame_Reader.h"
+#include "Protocol_Client.h"
+#include <stdio.h>
+
+static Frame_Reader reader;
+static Protocol_Board board;
+static uint8_t message[FRAME_MAX_ENCODED];
+
+static void Draw_Board(void)
+{
+	// Cursor home, so each frame is drawn over the previous one
+	printf("\x1B[H");
+
+	for (uint8_t y = 0; y < board.height; y++)
+	{
+		for (uint8_t x = 0; x < board.width; x++)
+		{
+			char glyph = '.';
+			if (board.cells[y * board.width + x])
+			{
+				glyph = 'O';
+			}
+			else if (board.walls[y * board.width + x])
+			{
+				glyph = '#';
+			}
+			else if (board.food_placed && x == board.food_x && y == board.food_y)
+			{
+				glyph = '*';
+			}
+			putchar(glyph);
+		}
+		printf("\x1B[K\n");
+	}
+
+	printf("Score: %u  Length: %u  %s\x1B[K\n", board.score, board.length,
+		board.game_over ? "Game over" : (board.synchronized ? "" : "Waiting for a keyframe"));
+	printf("Dropped deltas: %u  Bad frames: %u\x1B[K\n", board.dropped_deltas, reader.bad_frames);
+	fflush(stdout);
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *stream = stdin;
+	if (argc > 1)
+	{
+		stream = fopen(argv[1], "rb");
+		if (stream == NULL)
+		{
+			perror(argv[1]);
+			return 1;
+		}
+	}
+
+	Frame_Reader_Init(&reader);
+	Protocol_Client_Init(&board);
+
+	// Clear the screen once; each frame is then drawn from the top left corner
+	printf("\x1B[2J");
+
+	Frame_Status status;
+	uint16_t length;
+	while ((status = Frame_Read(&reader, stream, message, &length)) != FRAME_END)
+	{
+		if (status == FRAME_OK && Protocol_Client_Apply(&board, message, length) && board.width != 0)
+		{
+			Draw_Board();
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file TM4C123GH6PM.h
+ *
+ * @brief Host stand-in for the device header, used by the host tools and tests.
+ *
+ * The host programs build firmware headers and modules that include the device header but do not
+ * touch the peripherals, apart from the cycle counter and the memory barrier. Only those are
+ * defined here.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef tm4c123gh6pm_host_stub_header
+#define tm4c123gh6pm_host_stub_header
+#include <stdint.h>
+
+typedef struct
+{
+	volatile uint32_t CTRL;
+	volatile uint32_t CYCCNT;
+} DWT_Type;
+
+extern DWT_Type *DWT;
+
+#define __DMB() __sync_synchronize()
+#endif
@@ -0,0 +1,100 @@
+/**
+ * @file telemetry_csv.c
+ *
+ * @brief Host decoder for the telemetry stream of the Snake game.
+ *
+ * This program reads the records that the Telemetry driver sends on UART1, and writes one line
+ * of CSV per record to the standard output. The layout of a record is described in the header
+ * code of the Telemetry driver.
+ *
+ * The time column is in us since the first record. The DWT cycle count of the records wraps every
+ * 86 seconds, so the time is taken from the difference between two records, which is shorter.
+ * The gap column counts the ticks missing before a record, which the firmware drops when the
+ * line cannot keep up.
+ *
+ * Usage:
+ *  telemetry_csv [file] > telemetry.csv
+ * The stream is read from the file, or from the standard input. On Linux, the USB-to-serial
+ * adapter on PC5 can be read directly after it is set to raw mode:
+ *  stty -F /dev/ttyUSB0 115200 raw -echo
+ *  ./telemetry_csv /dev/ttyUSB0 > telemetry.csv
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Frame_Reader.h"
+#include "Telemetry.h"
+#include "Profiler.h"
+#include <stdio.h>
+#include <inttypes.h>
+
+static Frame_Reader reader;
+static uint8_t message[FRAME_MAX_ENCODED];
+
+static uint32_t Read_Le(const uint8_t *bytes, uint8_t size)
+{
+	uint32_t value = 0;
+	for (uint8_t i = size; i > 0; i--)
+	{
+		value = (value << 8) | bytes[i - 1];
+	}
+	return value;
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *stream = stdin;
+	if (argc > 1)
+	{
+		stream = fopen(argv[1], "rb");
+		if (stream == NULL)
+		{
+			perror(argv[1]);
+			return 1;
+		}
+	}
+
+	Frame_Reader_Init(&reader);
+	printf("tick,time_us,gap,head_x,head_y,direction,score,work_us,frame_bytes,tx_backlog,dropped\n");
+
+	uint32_t records = 0;
+	uint32_t last_tick = 0;
+	uint32_t last_cycles = 0;
+	uint64_t cycles = 0;
+
+	Frame_Status status;
+	uint16_t length;
+	while ((status = Frame_Read(&reader, stream, message, &length)) != FRAME_END)
+	{
+		if (status != FRAME_OK || length != TELEMETRY_RECORD_SIZE - 2 || message[0] != TELEMETRY_RECORD_TICK)
+		{
+			continue;
+		}
+
+		uint32_t tick = Read_Le(&message[1], 4);
+		uint32_t record_cycles = Read_Le(&message[5], 4);
+
+		// A new game numbers its ticks from the start again, so the gap is only counted within a game
+		uint32_t gap = 0;
+		if (records != 0)
+		{
+			cycles += record_cycles - last_cycles;
+			if (tick > last_tick)
+			{
+				gap = tick - last_tick - 1;
+			}
+		}
+		last_tick = tick;
+		last_cycles = record_cycles;
+		records++;
+
+		printf("%" PRIu32 ",%" PRIu64 ",%" PRIu32 ",%u,%u,%u,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\n",
+			tick, cycles / PROFILER_CYCLES_PER_US, gap,
+			message[9], message[10], message[11],
+			Read_Le(&message[12], 2), Read_Le(&message[14], 4), Read_Le(&message[18], 2),
+			Read_Le(&message[20], 2), Read_Le(&message[22], 2));
+	}
+
+	fprintf(stderr, "%" PRIu32 " records, %" PRIu32 " bad frames\n", records, reader.bad_frames);
+	return 0;
+}
@@ -0,0 +1,287 @@
+/**
+ * @file protocol_loopback.c
+ *
+ * @brief Host test of the Game_Protocol driver against the Protocol_Client module.
+ *
+ * The game logic and the Game_Protocol driver of the firmware are built for the host. The bytes
+ * that the firmware sends to UART0 go through the Frame_Reader into a Protocol_Board, which is
+ * compared with the game state after every tick, on every level, with and without wrap-around.
+ * The walls that the client decodes from the keyframes are compared with the loaded level.
+ *
+ * Some messages are dropped or have a byte changed on the way, so the test also checks that the
+ * client stops on a lost message and is back in sync by the next keyframe.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Frame_Reader.h"
+#include "Protocol_Client.h"
+#include "Game_Protocol.h"
+#include "Game_Logic.h"
+#include "Level_Pack.h"
+#include "UART0.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define GAMES_PER_MODE 25
+#define MAX_TICKS_PER_GAME 20000
+
+static DWT_Type host_dwt;
+DWT_Type *DWT = &host_dwt;
+
+static Frame_Reader reader;
+static Protocol_Board board;
+static uint8_t message[FRAME_MAX_ENCODED];
+static uint8_t line[FRAME_MAX_ENCODED];
+
+static uint32_t messages_sent = 0;
+static uint32_t messages_lost = 0;
+static uint32_t messages_since_loss = 0;
+static uint32_t head_on_last_tail = 0;
+static int failures = 0;
+
+// Changes one byte of the message in line. A changed COBS code byte would move the 0x00 bytes of
+// the message, which the CRC-16 misses once in about 65536 frames, so only a data byte is changed.
+static void Change_Data_Byte(uint16_t encoded_length)
+{
+	while (true)
+	{
+		uint16_t target = rand() % encoded_length;
+
+		// Each code byte gives the distance to the next one
+		uint16_t code_index = 0;
+		while (code_index < target)
+		{
+			code_index += line[code_index];
+		}
+
+		if (code_index != target)
+		{
+			// The byte must not become the 0x00 delimiter
+			line[target] ^= (line[target] == 0x40) ? 0x01 : 0x40;
+			return;
+		}
+	}
+}
+
+// The UART0 functions that the firmware modules call
+void UART0_Output_Buffer(const char *buffer, uint16_t length)
+{
+	messages_sent++;
+	messages_since_loss++;
+
+	// One message in 200 is lost, and one in 200 has a byte changed
+	int fault = rand() % 200;
+	if (fault == 0)
+	{
+		messages_lost++;
+		messages_since_loss = 0;
+		return;
+	}
+
+	for (uint16_t i = 0; i < length; i++)
+	{
+		line[i] = buffer[i];
+	}
+	if (fault == 1)
+	{
+		Change_Data_Byte(length - 1);
+		messages_lost++;
+		messages_since_loss = 0;
+	}
+
+	for (uint16_t i = 0; i < length; i++)
+	{
+		uint16_t message_length;
+		if (Frame_Reader_Push(&reader, line[i], message, &message_length) == FRAME_OK)
+		{
+			Protocol_Client_Apply(&board, message, message_length);
+		}
+	}
+}
+
+// Text and single bytes reach the reader without faults
+void UART0_Output_String(char *pt)
+{
+	while (*pt != 0)
+	{
+		UART0_Output_Character(*pt++);
+	}
+}
+
+void UART0_Output_Character(char data)
+{
+	uint16_t message_length;
+	if (Frame_Reader_Push(&reader, data, message, &message_length) == FRAME_OK)
+	{
+		Protocol_Client_Apply(&board, message, message_length);
+	}
+}
+
+void UART0_Output_Unsigned_Decimal(uint32_t n)
+{
+	(void)n;
+}
+
+void UART0_Output_Newline(void)
+{
+}
+
+static void Check(int condition, const char *what, int game, uint32_t tick)
+{
+	if (!condition && failures++ < 10)
+	{
+		printf("FAIL level %u wrap %d game %d tick %u: %s\n", level_selected, board_wrap, game, tick, what);
+	}
+}
+
+static void Check_Board(int game, uint32_t tick)
+{
+	// The client only sees that a message was lost when the next one comes
+	if (messages_since_loss == 0)
+	{
+		return;
+	}
+
+	// Up to one keyframe interval of messages can pass before the next keyframe
+	if (!board.synchronized)
+	{
+		Check(messages_since_loss <= PROTOCOL_KEYFRAME_INTERVAL + 1, "not back in sync by the next keyframe", game, tick);
+		return;
+	}
+
+	Check(board.width == GRID_WIDTH && board.height == GRID_HEIGHT, "board size", game, tick);
+	Check(board.head_x == CELL_X(snake_head) && board.head_y == CELL_Y(snake_head), "head", game, tick);
+	Check(board.score == (game_score & 0xFFFF), "score", game, tick);
+	Check(board.length == snake_length, "length", game, tick);
+	Check(board.level == level_loaded, "level", game, tick);
+	if (board.food_placed)
+	{
+		Check(board.food_x == CELL_X(food) && board.food_y == CELL_Y(food), "food", game, tick);
+	}
+
+	for (Cell cell = 0; cell < GRID_CELLS; cell++)
+	{
+		if (board.cells[cell] != (Cell_Occupied(cell) && !Level_Wall(cell)))
+		{
+			Check(0, "cells", game, tick);
+			return;
+		}
+		if (board.walls[cell] != Level_Wall(cell))
+		{
+			Check(0, "walls", game, tick);
+			return;
+		}
+	}
+}
+
+// Picks a move that does not hit the snake or a wall, and often follows the tail into its cell
+static void Choose_Direction(void)
+{
+	Direction safe[4];
+	uint8_t safe_count = 0;
+	for (Direction direction = UP; direction <= RIGHT; direction++)
+	{
+		Cell next = Cell_Neighbor(snake_head, direction);
+		if (next == CELL_NONE || (Cell_Occupied(next) && next != snake_tail))
+		{
+			continue;
+		}
+		if (next == snake_tail && snake_length > INITIAL_SNAKE_LENGTH && next != food && rand() % 2 == 0)
+		{
+			current_direction = direction;
+			return;
+		}
+		safe[safe_count++] = direction;
+	}
+
+	if (safe_count == 0)
+	{
+		return;
+	}
+
+	// Toward the food most of the time, so the snake grows
+	for (uint8_t i = 0; i < safe_count && rand() % 4 != 0; i++)
+	{
+		Cell next = Cell_Neighbor(snake_head, safe[i]);
+		int closer_x = abs((int)CELL_X(next) - (int)CELL_X(food)) < abs((int)CELL_X(snake_head) - (int)CELL_X(food));
+		int closer_y = abs((int)CELL_Y(next) - (int)CELL_Y(food)) < abs((int)CELL_Y(snake_head) - (int)CELL_Y(food));
+		if (closer_x || closer_y)
+		{
+			current_direction = safe[i];
+			return;
+		}
+	}
+	current_direction = safe[rand() % safe_count];
+}
+
+static void Play_Game(int game)
+{
+	random_state = 0x9E3779B9u * (uint32_t)(game + 1);
+	Game_Init();
+	Protocol_Init();
+
+	// The text that main prints between games comes before the first keyframe
+	UART0_Output_String("\nGAME OVER! Collision hit!\r\nYour final score is 12 points.\r\n");
+	Protocol_Send_Keyframe();
+	Check(messages_since_loss == 0 || board.synchronized, "first keyframe lost after the text", game, 0);
+	Check_Board(game, 0);
+
+	for (uint32_t tick = 1; tick <= MAX_TICKS_PER_GAME; tick++)
+	{
+		Choose_Direction();
+		bool snake_grew = Game_Step();
+		if (Check_Collision() || Game_Won())
+		{
+			Protocol_Send_Game_Over();
+			Check(messages_since_loss == 0 || board.game_over, "game over", game, tick);
+			return;
+		}
+
+		if (!snake_grew && snake_head == last_tail)
+		{
+			head_on_last_tail++;
+		}
+
+		Protocol_Send_Delta(snake_grew);
+		Check_Board(game, tick);
+	}
+}
+
+int main(void)
+{
+	srand(425);
+	Frame_Reader_Init(&reader);
+	Protocol_Client_Init(&board);
+
+	int game = 0;
+	for (uint8_t level = 0; level < LEVEL_COUNT; level++)
+	{
+		for (int wrap = 0; wrap <= 1; wrap++)
+		{
+			level_selected = level;
+			board_wrap = wrap;
+			for (int i = 0; i < GAMES_PER_MODE; i++)
+			{
+				Play_Game(game++);
+			}
+		}
+	}
+
+	printf("%d games, %u messages, %u lost or changed, %u bad frames, %u dropped deltas, %u moves into the last tail\n",
+		game, messages_sent, messages_lost, reader.bad_frames, board.dropped_deltas, head_on_last_tail);
+
+	if (head_on_last_tail == 0)
+	{
+		printf("FAIL no move into the cell of the last tail\n");
+		failures++;
+	}
+
+	if (failures != 0)
+	{
+		printf("FAIL %d checks\n", failures);
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,206 @@
+/**
+ * @file spsc_stress.c
+ *
+ * @brief Host stress test of the SPSC_Queue driver.
+ *
+ * A producer thread and a consumer thread pass a counting sequence through one queue, as an
+ * interrupt and the main loop do on the board. The producer uses SPSC_Queue_Push and
+ * SPSC_Queue_Push_Bulk with blocks of several sizes, some larger than the queue, and the consumer
+ * uses SPSC_Queue_Pop, SPSC_Queue_Pop_Bulk, and SPSC_Queue_Peek with SPSC_Queue_Skip in turn.
+ * The consumer checks that every number comes out once and in order.
+ *
+ * The high-water mark is checked exactly on a queue filled by one thread, and against the largest
+ * count the producer saw during the stress run.
+ *
+ * The DMB of the driver is a full barrier on the host (see stub/TM4C123GH6PM.h).
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "SPSC_Queue.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#define QUEUE_CAPACITY 64
+#define STRESS_COUNT 4000000u
+#define LARGEST_BLOCK (QUEUE_CAPACITY + 5)
+
+SPSC_QUEUE_DEFINE(stress_queue, uint32_t, QUEUE_CAPACITY);
+SPSC_QUEUE_DEFINE(single_queue, uint32_t, QUEUE_CAPACITY);
+
+// Largest count that the producer saw after a push, which the high-water mark must match
+static uint32_t producer_largest_count = 0;
+
+static void *Producer(void *argument)
+{
+	(void)argument;
+	uint32_t block[LARGEST_BLOCK];
+	uint32_t next = 0;
+	uint32_t block_size = 1;
+
+	while (next < STRESS_COUNT)
+	{
+		uint32_t added;
+		if (next % 3 == 0)
+		{
+			added = SPSC_Queue_Push(&stress_queue, &next) ? 1 : 0;
+		}
+		else
+		{
+			uint32_t count = block_size;
+			if (count > STRESS_COUNT - next)
+			{
+				count = STRESS_COUNT - next;
+			}
+			for (uint32_t i = 0; i < count; i++)
+			{
+				block[i] = next + i;
+			}
+			added = SPSC_Queue_Push_Bulk(&stress_queue, block, count);
+			block_size = (block_size % LARGEST_BLOCK) + 1;
+		}
+
+		// The count can only be lowered by the consumer, so it is a lower bound of the count
+		// right after the push
+		uint32_t count = SPSC_Queue_Count(&stress_queue);
+		if (count > producer_largest_count)
+		{
+			producer_largest_count = count;
+		}
+
+		next += added;
+		if (added == 0)
+		{
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static int Check_Single_Thread(void)
+{
+	uint32_t value = 0;
+
+	// Fill the queue part way, empty it, then fill it to the top across the end of the buffer
+	for (uint32_t i = 0; i < 10; i++)
+	{
+		SPSC_Queue_Push(&single_queue, &i);
+	}
+	if (SPSC_Queue_High_Water(&single_queue) != 10)
+	{
+		printf("FAIL high-water mark %u after 10 pushes\n", SPSC_Queue_High_Water(&single_queue));
+		return 1;
+	}
+	SPSC_Queue_Flush(&single_queue);
+
+	uint32_t block[QUEUE_CAPACITY + 1];
+	for (uint32_t i = 0; i <= QUEUE_CAPACITY; i++)
+	{
+		block[i] = i;
+	}
+	if (SPSC_Queue_Push_Bulk(&single_queue, block, QUEUE_CAPACITY + 1) != QUEUE_CAPACITY
+		|| SPSC_Queue_Push(&single_queue, &value) || SPSC_Queue_Free(&single_queue) != 0)
+	{
+		printf("FAIL a full queue accepted an element\n");
+		return 1;
+	}
+	if (SPSC_Queue_High_Water(&single_queue) != QUEUE_CAPACITY)
+	{
+		printf("FAIL high-water mark %u on a full queue\n", SPSC_Queue_High_Water(&single_queue));
+		return 1;
+	}
+
+	for (uint32_t i = 0; i < QUEUE_CAPACITY; i++)
+	{
+		if (!SPSC_Queue_Pop(&single_queue, &value) || value != i)
+		{
+			printf("FAIL element %u of a full queue\n", i);
+			return 1;
+		}
+	}
+	if (SPSC_Queue_Pop(&single_queue, &value) || SPSC_Queue_Peek(&single_queue) != NULL)
+	{
+		printf("FAIL an empty queue returned an element\n");
+		return 1;
+	}
+	return 0;
+}
+
+int main(void)
+{
+	if (Check_Single_Thread())
+	{
+		return 1;
+	}
+
+	pthread_t producer;
+	pthread_create(&producer, NULL, Producer, NULL);
+
+	uint32_t expected = 0;
+	uint32_t block[QUEUE_CAPACITY];
+	uint32_t turn = 0;
+	while (expected < STRESS_COUNT)
+	{
+		uint32_t removed = 0;
+		switch (turn++ % 3)
+		{
+			case 0:
+			{
+				uint32_t value;
+				if (SPSC_Queue_Pop(&stress_queue, &value))
+				{
+					block[0] = value;
+					removed = 1;
+				}
+				break;
+			}
+
+			case 1:
+			{
+				removed = SPSC_Queue_Pop_Bulk(&stress_queue, block, 1 + (turn % QUEUE_CAPACITY));
+				break;
+			}
+
+			default:
+			{
+				const uint32_t *element = SPSC_Queue_Peek(&stress_queue);
+				if (element != NULL)
+				{
+					block[0] = *element;
+					SPSC_Queue_Skip(&stress_queue);
+					removed = 1;
+				}
+				break;
+			}
+		}
+
+		for (uint32_t i = 0; i < removed; i++)
+		{
+			if (block[i] != expected)
+			{
+				printf("FAIL got %u, expected %u\n", block[i], expected);
+				return 1;
+			}
+			expected++;
+		}
+
+		if (removed == 0)
+		{
+			sched_yield();
+		}
+	}
+	pthread_join(producer, NULL);
+
+	uint32_t high_water = SPSC_Queue_High_Water(&stress_queue);
+	printf("%u elements in order, high-water mark %u of %u (producer saw %u)\n",
+		expected, high_water, QUEUE_CAPACITY, producer_largest_count);
+
+	if (SPSC_Queue_Count(&stress_queue) != 0 || high_water > QUEUE_CAPACITY || high_water < producer_largest_count)
+	{
+		printf("FAIL high-water mark\n");
+		return 1;
+	}
+	printf("PASS\n");
+	return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file Attract_Mode.c
+ *
+ * @brief Source code for the Attract_Mode driver.
+ *
+ * This file contains the function definitions for the Attract_Mode driver.
+ * More information about the demo and its budget is on the header code of the
+ * Attract_Mode driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Attract_Mode.h"
+#include "Game_Display.h"
+#include "UART0.h"
+
+// The move that would reverse each direction into the body
+static const Direction opposite_direction[4] = {DOWN, UP, RIGHT, LEFT};
+
+static uint16_t Attract_Mode_Distance(Cell a, Cell b)
+{
+	uint8_t dx = (CELL_X(a) > CELL_X(b)) ? CELL_X(a) - CELL_X(b) : CELL_X(b) - CELL_X(a);
+	uint8_t dy = (CELL_Y(a) > CELL_Y(b)) ? CELL_Y(a) - CELL_Y(b) : CELL_Y(b) - CELL_Y(a);
+	
+	// On a wrapped board, the way around the edge may be shorter
+	if (board_wrap)
+	{
+		if (dx > GRID_WIDTH - dx)
+		{
+			dx = GRID_WIDTH - dx;
+		}
+		if (dy > GRID_HEIGHT - dy)
+		{
+			dy = GRID_HEIGHT - dy;
+		}
+	}
+	return dx + dy;
+}
+
+static bool Attract_Mode_Move_Safe(Direction direction)
+{
+	Cell next = Cell_Neighbor(snake_head, direction);
+	if (next == CELL_NONE)
+	{
+		return false;
+	}
+	
+	// The tail leaves its cell during the move, unless the snake eats
+	return !Cell_Occupied(next) || (next == snake_tail && next != food);
+}
+
+Direction Attract_Mode_Direction(void)
+{
+	Direction best_direction = current_direction;
+	uint16_t best_distance = 0xFFFF;
+	
+	if (Attract_Mode_Move_Safe(current_direction))
+	{
+		best_distance = Attract_Mode_Distance(Cell_Neighbor(snake_head, current_direction), food);
+	}
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		Direction direction = (Direction)i;
+		if (direction == current_direction || direction == opposite_direction[current_direction])
+		{
+			continue;
+		}
+		if (Attract_Mode_Move_Safe(direction))
+		{
+			uint16_t distance = Attract_Mode_Distance(Cell_Neighbor(snake_head, direction), food);
+			if (distance < best_distance)
+			{
+				best_direction = direction;
+				best_distance = distance;
+			}
+		}
+	}
+	return best_direction;
+}
+
+void Attract_Mode_Start(void)
+{
+	Game_Init();
+	render_mode = RENDER_MODE_CURSOR_DELTA;
+	Display_Reset();
+	Draw_Frame(ATTRACT_MODE_TICK_MS, false);
+	
+	// The delta frames never rewrite the line below the board
+	Display_Move_Below_Board();
+	UART0_Output_String("DEMO - Press any key to return to the title screen.");
+}
+
+bool Attract_Mode_Tick(void)
+{
+	current_direction = Attract_Mode_Direction();
+	bool snake_grew = Game_Step();
+	if (Check_Collision() || Game_Won())
+	{
+		return false;
+	}
+	Draw_Frame(ATTRACT_MODE_TICK_MS, snake_grew);
+	return true;
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Attract_Mode.h
+ *
+ * @brief Header code for the Attract_Mode driver.
+ *
+ * This file contains the function definitions for the Attract_Mode driver.
+ * When nobody presses a key on the title screen for ATTRACT_MODE_IDLE_MS, a demo game is played
+ * by a simple AI until a key is pressed or the demo snake crashes.
+ *
+ * The demo is kept within a fixed budget so that it does not slow down the title screen:
+ *  - CPU: one tick every ATTRACT_MODE_TICK_MS. The AI checks at most three cells per tick,
+ *    so a tick costs about as much as Game_Step.
+ *  - UART: the demo only runs with the cursor delta renderer. After the first full redraw, each
+ *    frame only rewrites the head, the vacated tail, the food, and the score, which is less than
+ *    ATTRACT_MODE_FRAME_BYTES bytes every ATTRACT_MODE_TICK_MS (under 2% of 115200 baud).
+ *  - Input: the main loop checks the Input_Queue between demo ticks, so a key stops the demo
+ *    within one tick, and at worst waits for the frame that is being sent.
+ *
+ * The demo does not touch the saved game, the high score table, or the traces.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef attract_mode_header
+#define attract_mode_header
+#include "Game_Logic.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ATTRACT_MODE_IDLE_MS 10000
+#define ATTRACT_MODE_TICK_MS 250
+
+// Upper bound of the size of a demo frame after the first one
+#define ATTRACT_MODE_FRAME_BYTES 64
+
+/**
+ * @brief The Attract_Mode_Start function starts a new demo game and draws its first frame.
+ *
+ * It selects the cursor delta renderer, so it must only be called if the terminal supports it.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Attract_Mode_Start(void);
+
+/**
+ * @brief The Attract_Mode_Tick function plays and draws one tick of the demo game.
+ *
+ * @param None
+ *
+ * @return False if the demo game ended; true otherwise.
+ */
+bool Attract_Mode_Tick(void);
+
+/**
+ * @brief The Attract_Mode_Direction function picks the move of the demo snake.
+ *
+ * Of the moves that do not hit a wall or the body, it picks the one that gets closest to the food,
+ * and keeps the current direction on a tie. If every move is blocked, the direction is kept.
+ *
+ * @param None
+ *
+ * @return The direction of the next move.
+ */
+Direction Attract_Mode_Direction(void);
+#endif
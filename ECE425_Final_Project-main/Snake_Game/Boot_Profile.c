@@ -0,0 +1,77 @@
+/**
+ * @file Boot_Profile.c
+ *
+ * @brief Source code for the Boot_Profile driver.
+ *
+ * This file contains the function definitions for the Boot_Profile driver.
+ * More information about the stages of the boot is on the header code of the Boot_Profile driver.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Boot_Profile.h"
+#include "UART0.h"
+
+static uint32_t stage_cycles[BOOT_STAGE_COUNT];
+
+// In the order of Boot_Stage
+static const char *const stage_names[BOOT_STAGE_COUNT] =
+{
+	"SystemInit",
+	"C library startup",
+	"UART0",
+	"First byte",
+	"Title screen queued",
+	"Timers, LEDs, telemetry",
+	"EEPROM",
+	"Terminal probe",
+	"Input ready"
+};
+
+void Boot_Profile_Start(void)
+{
+	stage_cycles[BOOT_STAGE_SYSTEM_INIT] = Boot_System_Init_Cycles;
+	stage_cycles[BOOT_STAGE_C_RUNTIME] = PROFILER_CYCLES();
+}
+
+void Boot_Profile_Stamp(Boot_Stage stage)
+{
+	stage_cycles[stage] = PROFILER_CYCLES();
+}
+
+void Boot_Profile_Report(void)
+{
+	UART0_Output_String(FAST_BOOT ? "Fast boot, " : "Boot, ");
+	UART0_Output_String("us from reset:");
+
+	// The order of the stages depends on FAST_BOOT, so they are printed from the earliest
+	uint32_t printed = 0;
+	uint32_t last_cycles = 0;
+	for (uint8_t i = 0; i < BOOT_STAGE_COUNT; i++)
+	{
+		uint8_t next = BOOT_STAGE_COUNT;
+		for (uint8_t stage = 0; stage < BOOT_STAGE_COUNT; stage++)
+		{
+			if ((printed & (1 << stage)) == 0 && (next == BOOT_STAGE_COUNT || stage_cycles[stage] < stage_cycles[next]))
+			{
+				next = stage;
+			}
+		}
+		printed |= 1 << next;
+
+		UART0_Output_Newline();
+		UART0_Output_String("  ");
+		UART0_Output_String((char *)stage_names[next]);
+		UART0_Output_String(": ");
+		UART0_Output_Unsigned_Decimal(Profiler_Cycles_To_us(stage_cycles[next]));
+		UART0_Output_String(" (+");
+		UART0_Output_Unsigned_Decimal(Profiler_Cycles_To_us(stage_cycles[next] - last_cycles));
+		UART0_Output_String(")");
+		last_cycles = stage_cycles[next];
+	}
+
+	UART0_Output_Newline();
+	UART0_Output_String("Reset to first byte: ");
+	UART0_Output_Unsigned_Decimal(Profiler_Cycles_To_us(stage_cycles[BOOT_STAGE_FIRST_BYTE]));
+	UART0_Output_String(" us");
+}
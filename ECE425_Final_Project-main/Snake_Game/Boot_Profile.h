@@ -0,0 +1,89 @@
+/**
+ * @file Boot_Profile.h
+ *
+ * @brief Header code for the Boot_Profile driver.
+ *
+ * This file contains the function definitions for the Boot_Profile driver.
+ * It records the DWT cycle count at the end of each stage of the boot, so the time from reset
+ * to the first byte on UART0 and to the first key that can be read is known.
+ *
+ * The Reset_Handler in startup_TM4C123.s starts the cycle counter before it calls SystemInit,
+ * so the counts are taken from reset. The count at the end of SystemInit is kept in
+ * Boot_System_Init_Cycles, a word of a NOINIT area that the C library does not clear before main.
+ * The stage after it is the C library startup (__main), which copies the initialized data and
+ * clears the zero-initialized data.
+ *
+ * When FAST_BOOT is 1, main sends the title screen right after UART0_Init, and sets up the other
+ * modules while the title screen is on the wire:
+ *  - The timers, the LEDs, the phase trace pins, and the telemetry on UART1
+ *  - The EEPROM, which loads the high scores in the background
+ *  - The terminal probe, once the title screen is sent, so the replies are not delayed by it
+ *  - The Input_Queue and the EduBase buttons, since the probe reads UART0 without interrupts
+ * When FAST_BOOT is 0, the modules are set up first, as before, and the title screen is sent last.
+ *
+ * The times are printed by the boot command of the Debug_Console driver.
+ *
+ * @note SystemInit starts on the 16 MHz precision internal oscillator and switches to the 50 MHz PLL,
+ * so the time shown for SystemInit, which assumes 50 MHz, is shorter than the real time.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef boot_profile_header
+#define boot_profile_header
+#include "Profiler.h"
+#include <stdint.h>
+
+// Set to 0 to set up every module before the title screen is sent
+#ifndef FAST_BOOT
+#define FAST_BOOT 1
+#endif
+
+typedef enum
+{
+	BOOT_STAGE_SYSTEM_INIT,
+	BOOT_STAGE_C_RUNTIME,
+	BOOT_STAGE_UART,
+	BOOT_STAGE_FIRST_BYTE,
+	BOOT_STAGE_TITLE,
+	BOOT_STAGE_PERIPHERALS,
+	BOOT_STAGE_EEPROM,
+	BOOT_STAGE_PROBE,
+	BOOT_STAGE_INPUT,
+	BOOT_STAGE_COUNT
+} Boot_Stage;
+
+/**
+ * @brief The cycle count at the end of SystemInit, written by the Reset_Handler.
+ */
+extern uint32_t Boot_System_Init_Cycles;
+
+/**
+ * @brief The Boot_Profile_Start function records the end of SystemInit and of the C library
+ * startup. It must be called first in main.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Boot_Profile_Start(void);
+
+/**
+ * @brief The Boot_Profile_Stamp function records the end of a stage of the boot.
+ *
+ * @param stage The stage that ended.
+ *
+ * @return None
+ */
+void Boot_Profile_Stamp(Boot_Stage stage);
+
+/**
+ * @brief The Boot_Profile_Report function prints the time from reset to the end of each stage,
+ * in the order in which the stages ended, to the serial terminal.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Boot_Profile_Report(void);
+#endif
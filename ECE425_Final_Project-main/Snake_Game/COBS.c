@@ -0,0 +1,71 @@
+/**
+ * @file COBS.c
+ *
+ * @brief Source code for the COBS driver.
+ *
+ * This file contains the function definitions for the COBS driver.
+ * Each block of the encoded message starts with a code byte, which is one more than the number of
+ * non-zero bytes that follow it before the next 0x00 byte of the message.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "COBS.h"
+
+uint16_t COBS_Encode(const uint8_t *data, uint16_t length, uint8_t *output)
+{
+	uint16_t code_index = 0;
+	uint16_t output_index = 1;
+	uint8_t code = 1;
+
+	for (uint16_t i = 0; i < length; i++)
+	{
+		if (data[i] != 0)
+		{
+			output[output_index++] = data[i];
+			code++;
+		}
+
+		// Close the block on a zero byte or when the block reaches its maximum size
+		if (data[i] == 0 || code == 0xFF)
+		{
+			output[code_index] = code;
+			code = 1;
+			code_index = output_index++;
+		}
+	}
+	output[code_index] = code;
+	return output_index;
+}
+
+bool COBS_Decode(const uint8_t *data, uint16_t length, uint8_t *output, uint16_t *decoded_length)
+{
+	uint16_t input_index = 0;
+	uint16_t output_index = 0;
+
+	while (input_index < length)
+	{
+		uint8_t code = data[input_index++];
+		if (code == 0)
+		{
+			return false;
+		}
+
+		for (uint8_t i = 1; i < code; i++)
+		{
+			if (input_index == length || data[input_index] == 0)
+			{
+				return false;
+			}
+			output[output_index++] = data[input_index++];
+		}
+
+		// A block shorter than the maximum ended on a 0x00 byte, except the last block
+		if (code != 0xFF && input_index < length)
+		{
+			output[output_index++] = 0;
+		}
+	}
+	*decoded_length = output_index;
+	return true;
+}
@@ -0,0 +1,51 @@
+/**
+ * @file COBS.h
+ *
+ * @brief Header code for the COBS driver.
+ *
+ * This file contains the function definitions for the COBS driver.
+ * Consistent Overhead Byte Stuffing (COBS) removes every 0x00 byte from a message, so that a 0x00
+ * byte can mark the end of each message in a serial stream. A receiver that starts in the middle
+ * of the stream can resynchronize at the next 0x00 byte.
+ *
+ * The firmware only encodes; COBS_Decode is used by the host tools in Host_Tools, which build
+ * this file as it is.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef cobs_header
+#define cobs_header
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief The largest size of an encoded message: COBS adds one byte per 254 bytes of data plus one.
+ * The 0x00 delimiter is not included.
+ */
+#define COBS_MAX_ENCODED(length) ((length) + ((length) / 254) + 1)
+
+/**
+ * @brief The COBS_Encode function encodes a message. The 0x00 delimiter is not added.
+ *
+ * @param data The message to encode.
+ * @param length The length of the message.
+ * @param output The buffer that receives the encoded message. It must hold COBS_MAX_ENCODED(length) bytes.
+ *
+ * @return The length of the encoded message.
+ */
+uint16_t COBS_Encode(const uint8_t *data, uint16_t length, uint8_t *output);
+
+/**
+ * @brief The COBS_Decode function decodes a message. The 0x00 delimiter must not be included.
+ *
+ * @param data The encoded message.
+ * @param length The length of the encoded message.
+ * @param output The buffer that receives the message. It must hold length bytes.
+ * @param decoded_length Receives the length of the message.
+ *
+ * @return False if the encoded message is malformed (a 0x00 byte, or a block that runs past
+ * the end); true otherwise.
+ */
+bool COBS_Decode(const uint8_t *data, uint16_t length, uint8_t *output, uint16_t *decoded_length);
+#endif
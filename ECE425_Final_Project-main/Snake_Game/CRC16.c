@@ -0,0 +1,33 @@
+/**
+ * @file CRC16.c
+ *
+ * @brief Source code for the CRC16 driver.
+ *
+ * This file contains the function definitions for the CRC16 driver.
+ * The checksum is computed one bit at a time, which avoids a 512-byte lookup table
+ * since the checked buffers are short.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "CRC16.h"
+
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *data, uint16_t length)
+{
+	for (uint16_t i = 0; i < length; i++)
+	{
+		crc ^= (uint16_t)data[i] << 8;
+		for (int bit = 0; bit < 8; bit++)
+		{
+			if (crc & 0x8000)
+			{
+				crc = (crc << 1) ^ 0x1021;
+			}
+			else
+			{
+				crc = crc << 1;
+			}
+		}
+	}
+	return crc;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file CRC16.h
+ *
+ * @brief Header code for the CRC16 driver.
+ *
+ * This file contains the function definitions for the CRC16 driver.
+ * It computes the CRC-16/CCITT-FALSE checksum (polynomial 0x1021, initial value 0xFFFF), which
+ * is used to check the binary messages of the Game_Protocol driver and the records saved in the
+ * EEPROM.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef crc16_header
+#define crc16_header
+#include <stdint.h>
+
+#define CRC16_INITIAL 0xFFFF
+
+/**
+ * @brief The CRC16_Update function adds bytes to a CRC-16/CCITT-FALSE checksum.
+ *
+ * A checksum over several buffers is computed by passing the result of one call to the next.
+ *
+ * @param crc CRC16_INITIAL for the first buffer, or the result of the previous call.
+ * @param data The bytes to add.
+ * @param length The number of bytes.
+ *
+ * @return The updated checksum.
+ */
+uint16_t CRC16_Update(uint16_t crc, const uint8_t *data, uint16_t length);
+#endif
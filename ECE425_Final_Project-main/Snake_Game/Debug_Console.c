@@ -0,0 +1,359 @@
+/**
+ * @file Debug_Console.c
+ *
+ * @brief Source code for the Debug_Console driver.
+ *
+ * This file contains the function definitions for the Debug_Console driver.
+ * More information about the commands is on the header code of the Debug_Console driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Debug_Console.h"
+#include "Game_Logic.h"
+#include "Level_Pack.h"
+#include "Game_Display.h"
+#include "Game_Stress_Test.h"
+#include "Input_Queue.h"
+#include "Phase_Trace.h"
+#include "Event_Trace.h"
+#include "Game_Timer.h"
+#include "Difficulty.h"
+#include "UART1.h"
+#include "Low_Power.h"
+#include "Boot_Profile.h"
+#include "Save_State.h"
+#include "Profiler.h"
+#include "UART0.h"
+#include <string.h>
+
+// Range of the set speed command in ms. The fastest tick is the one of the difficulty curves, and
+// the slowest keeps the period in 1/256 us far from the 32-bit limit (16777 ms)
+#define DEBUG_CONSOLE_MIN_SPEED_MS (DIFFICULTY_MINIMUM_PERIOD / DIFFICULTY_US(1000))
+#define DEBUG_CONSOLE_MAX_SPEED_MS 5000
+
+static bool console_active = false;
+
+// Set when a command changes the game state outside of Game_Step, so the game is saved again
+static bool game_state_changed = false;
+static char line[DEBUG_CONSOLE_LINE_SIZE + 1];
+static uint8_t line_length = 0;
+
+// Position of the next word of the command line that has not been parsed
+static char *parse_position;
+
+static uint32_t tick_count = 0;
+static uint32_t last_tick_cycles = 0;
+static uint32_t max_tick_cycles = 0;
+
+// The body of the game in progress, kept while the bench command uses the game logic
+static uint8_t saved_moves[(MAX_SNAKE_LENGTH + 3) / 4];
+
+static void Debug_Console_Close(void)
+{
+	console_active = false;
+
+	// The journal only replays the moves, so a new seed or speed would be lost when the game is resumed
+	if (game_state_changed)
+	{
+		Save_State_Checkpoint();
+		game_state_changed = false;
+	}
+}
+
+static void Debug_Console_Prompt(void)
+{
+	UART0_Output_Newline();
+	UART0_Output_String("> ");
+	line_length = 0;
+}
+
+static char *Debug_Console_Next_Word(void)
+{
+	while (*parse_position == ' ')
+	{
+		parse_position++;
+	}
+
+	char *word = parse_position;
+	while (*parse_position != ' ' && *parse_position != 0)
+	{
+		parse_position++;
+	}
+
+	if (*parse_position == ' ')
+	{
+		*parse_position = 0;
+		parse_position++;
+	}
+	return word;
+}
+
+static bool Debug_Console_Next_Number(uint32_t *number)
+{
+	// Like UART0_Input_Unsigned_Decimal, but the digits are read from the command line
+	char *word = Debug_Console_Next_Word();
+	if (*word == 0)
+	{
+		return false;
+	}
+
+	*number = 0;
+	while (*word != 0)
+	{
+		if (*word < '0' || *word > '9')
+		{
+			return false;
+		}
+		*number = (10 * *number) + (*word - '0');
+		word++;
+	}
+	return true;
+}
+
+static void Debug_Console_Output_Label(char *label, uint32_t value, char *unit)
+{
+	UART0_Output_Newline();
+	UART0_Output_String(label);
+	UART0_Output_Unsigned_Decimal(value);
+	UART0_Output_String(unit);
+}
+
+static void Debug_Console_Help(void)
+{
+	UART0_Output_Newline();
+	UART0_Output_String("Commands: stats, set speed <ms>, set curve <n>, curves, seed <n>, bench, boot, jitter, trace dump, events, resume");
+}
+
+static void Debug_Console_Stats(void)
+{
+	Debug_Console_Output_Label("Ticks: ", tick_count, "");
+	Debug_Console_Output_Label("Last tick work: ", Profiler_Cycles_To_us(last_tick_cycles), " us");
+	Debug_Console_Output_Label("Longest tick work: ", Profiler_Cycles_To_us(max_tick_cycles), " us");
+	Debug_Console_Output_Label("Last frame: ", frame_bytes_sent, " bytes");
+	Debug_Console_Output_Label("Frame assembly: ", frame_assembly_us, " us");
+	Debug_Console_Output_Label("Tick period: ", snake_period / DIFFICULTY_US(1), " us");
+	Debug_Console_Output_Label("Difficulty curve: ", difficulty_curve, " (");
+	UART0_Output_String((char *)difficulty_curves[difficulty_curve].name);
+	UART0_Output_String(")");
+	Debug_Console_Output_Label("CPU idle this game: ", Low_Power_Idle_Percent(), "%");
+	Debug_Console_Output_Label("Random state: ", random_state, "");
+	Debug_Console_Output_Label("Queue high-water marks: input ", Input_Queue_High_Water(), "/");
+	UART0_Output_Unsigned_Decimal(INPUT_QUEUE_SIZE);
+	UART0_Output_String(", UART0 TX ");
+	UART0_Output_Unsigned_Decimal(UART0_TX_High_Water());
+	UART0_Output_Character('/');
+	UART0_Output_Unsigned_Decimal(UART0_TX_BUFFER_SIZE);
+	UART0_Output_String(", UART1 TX ");
+	UART0_Output_Unsigned_Decimal(UART1_TX_High_Water());
+	UART0_Output_Character('/');
+	UART0_Output_Unsigned_Decimal(UART1_TX_BUFFER_SIZE);
+	UART0_Output_Newline();
+	Input_Report_Latency();
+}
+
+// The snake follows the cycle of the stress test on the open level, so it never collides.
+// The cycle never crosses an edge, so the moves are the same on a wrapped board.
+static uint32_t Debug_Console_Bench_Logic(bool wrap)
+{
+	board_wrap = wrap;
+	Game_Init_Snake_At(INITIAL_SNAKE_LENGTH - 1, 0, RIGHT);
+	uint32_t start_cycles = PROFILER_CYCLES();
+	for (int i = 0; i < DEBUG_CONSOLE_BENCH_TICKS; i++)
+	{
+		current_direction = Game_Stress_Test_Direction(snake_head);
+		Game_Step();
+	}
+	return (PROFILER_CYCLES() - start_cycles) / DEBUG_CONSOLE_BENCH_TICKS;
+}
+
+static void Debug_Console_Bench(void)
+{
+	// Keep the game in progress, since the bench plays its own game with the same logic
+	Cell saved_tail = snake_tail;
+	Cell saved_food = food;
+	uint16_t saved_length = snake_length;
+	Direction saved_direction = current_direction;
+	uint32_t saved_score = game_score;
+	uint32_t saved_random_state = random_state;
+	uint32_t saved_period = snake_period;
+	uint32_t saved_delay_ms = snake_delay_ms;
+	uint8_t saved_level = level_loaded;
+	bool saved_wrap = board_wrap;
+	Snake_Save_Body(saved_moves, sizeof(saved_moves));
+
+	// The edges are checked by the switch of Snake_Move with walls, and by the neighbor lookup when wrapped
+	Level_Load(LEVEL_OPEN);
+	uint32_t logic_cycles = Debug_Console_Bench_Logic(false);
+	uint32_t wrap_logic_cycles = Debug_Console_Bench_Logic(true);
+
+	board_wrap = saved_wrap;
+	Level_Load(saved_level);
+	Snake_Load_Body(saved_tail, saved_length, saved_moves);
+	food = saved_food;
+	current_direction = saved_direction;
+	game_score = saved_score;
+	random_state = saved_random_state;
+	snake_period = saved_period;
+	snake_delay_ms = saved_delay_ms;
+
+	// The board of the game in progress is assembled, but not sent
+	uint32_t render_cycles = Display_Benchmark(DEBUG_CONSOLE_BENCH_FRAMES);
+
+	Debug_Console_Output_Label("Logic: ", logic_cycles, " cycles per tick with walls, ");
+	UART0_Output_Unsigned_Decimal(wrap_logic_cycles);
+	UART0_Output_String(" wrapped");
+	Debug_Console_Output_Label("Board assembly: ", render_cycles, " cycles per frame (");
+	UART0_Output_Unsigned_Decimal(Profiler_Cycles_To_us(render_cycles));
+	UART0_Output_String(" us)");
+}
+
+static void Debug_Console_Run(void)
+{
+	parse_position = line;
+	char *command = Debug_Console_Next_Word();
+	uint32_t number;
+
+	if (strcmp(command, "help") == 0)
+	{
+		Debug_Console_Help();
+	}
+	else if (strcmp(command, "stats") == 0)
+	{
+		Debug_Console_Stats();
+	}
+	else if (strcmp(command, "set") == 0)
+	{
+		char *setting = Debug_Console_Next_Word();
+		if (strcmp(setting, "speed") == 0 && Debug_Console_Next_Number(&number))
+		{
+			// A period that overflows to 0 would stop the tick timer, so the number is clamped first
+			if (number < DEBUG_CONSOLE_MIN_SPEED_MS || number > DEBUG_CONSOLE_MAX_SPEED_MS)
+			{
+				number = (number < DEBUG_CONSOLE_MIN_SPEED_MS) ? DEBUG_CONSOLE_MIN_SPEED_MS : DEBUG_CONSOLE_MAX_SPEED_MS;
+				UART0_Output_Newline();
+				UART0_Output_String("Speed clamped to ");
+				UART0_Output_Unsigned_Decimal(number);
+				UART0_Output_String(" ms");
+			}
+			snake_period = DIFFICULTY_US(number * 1000);
+			snake_delay_ms = number;
+			game_state_changed = true;
+		}
+		else if (strcmp(setting, "curve") == 0 && Debug_Console_Next_Number(&number) && number < DIFFICULTY_CURVE_COUNT)
+		{
+			difficulty_curve = number;
+			UART0_Output_Newline();
+			UART0_Output_String("The new curve is used the next time the snake eats");
+		}
+		else
+		{
+			UART0_Output_Newline();
+			UART0_Output_String("Usage: set speed <ms> with <ms> from 20 to 5000, or set curve <n> (see curves)");
+		}
+	}
+	else if (strcmp(command, "seed") == 0)
+	{
+		// A xorshift generator stays at 0 forever, so 0 is not accepted
+		if (Debug_Console_Next_Number(&number) && number != 0)
+		{
+			random_state = number;
+			game_state_changed = true;
+		}
+		else
+		{
+			UART0_Output_Newline();
+			UART0_Output_String("Usage: seed <n>, where n is not 0");
+		}
+	}
+	else if (strcmp(command, "bench") == 0)
+	{
+		Debug_Console_Bench();
+	}
+	else if (strcmp(command, "trace") == 0 && strcmp(Debug_Console_Next_Word(), "dump") == 0)
+	{
+		UART0_Output_Newline();
+		Phase_Trace_Dump_VCD();
+	}
+	else if (strcmp(command, "curves") == 0)
+	{
+		UART0_Output_Newline();
+		Difficulty_Report();
+	}
+	else if (strcmp(command, "boot") == 0)
+	{
+		UART0_Output_Newline();
+		Boot_Profile_Report();
+	}
+	else if (strcmp(command, "jitter") == 0)
+	{
+		UART0_Output_Newline();
+		Game_Timer_Report_Jitter();
+	}
+	else if (strcmp(command, "events") == 0)
+	{
+		UART0_Output_Newline();
+		Event_Trace_Dump();
+	}
+	else if (strcmp(command, "resume") == 0)
+	{
+		Debug_Console_Close();
+		return;
+	}
+	else if (*command != 0)
+	{
+		UART0_Output_Newline();
+		UART0_Output_String("Unknown command. Type help for the list of commands.");
+	}
+	Debug_Console_Prompt();
+}
+
+void Debug_Console_Open(void)
+{
+	console_active = true;
+	Display_Move_Below_Board();
+	UART0_Output_Newline();
+	UART0_Output_String("Game paused. Type help for the list of commands, or press ESC to resume.");
+	Debug_Console_Prompt();
+}
+
+bool Debug_Console_Active(void)
+{
+	return console_active;
+}
+
+void Debug_Console_Key(char key)
+{
+	if (key == UART0_ESC)
+	{
+		Debug_Console_Close();
+	}
+	else if (key == UART0_CR)
+	{
+		line[line_length] = 0;
+		Debug_Console_Run();
+	}
+	else if (key == UART0_BS || key == UART0_DEL)
+	{
+		if (line_length)
+		{
+			line_length--;
+			UART0_Output_String("\b \b");
+		}
+	}
+	else if (key >= ' ' && line_length < DEBUG_CONSOLE_LINE_SIZE)
+	{
+		line[line_length++] = key;
+		UART0_Output_Character(key);
+	}
+}
+
+void Debug_Console_Record_Tick(uint32_t work_cycles)
+{
+	tick_count++;
+	last_tick_cycles = work_cycles;
+	if (work_cycles > max_tick_cycles)
+	{
+		max_tick_cycles = work_cycles;
+	}
+}
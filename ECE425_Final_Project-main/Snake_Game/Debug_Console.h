@@ -0,0 +1,84 @@
+/**
+ * @file Debug_Console.h
+ *
+ * @brief Header code for the Debug_Console driver.
+ *
+ * This file contains the function definitions for the Debug_Console driver.
+ * Pressing ESC during a game pauses it and opens a command line below the board, where the
+ * speed of the game can be tuned and its timing inspected without rebuilding the program:
+ *
+ *  help                        Lists the commands
+ *  stats                       Prints the tick, frame, queue, idle time, and input latency counters
+ *  set speed <ms>              Sets the current period between ticks, from 20 to 5000 ms
+ *  set curve <n>               Selects difficulty curve n, from the next time the snake eats
+ *  curves                      Prints the tick period of each difficulty curve at a few scores
+ *  seed <n>                    Sets the state of the random number generator (n must not be 0)
+ *  bench                       Times the game logic (with walls and wrapped) and the board assembly on this board
+ *  boot                        Prints the time from reset to the end of each stage of the boot
+ *  jitter                      Prints the tick jitter histogram of the Game_Timer driver
+ *  trace dump                  Prints the timing of the last ticks as a VCD file
+ *  events                      Sends the last game events in the binary form of the Event_Trace driver
+ *  resume                      Closes the console and redraws the game (ESC does the same)
+ *
+ * The seed and set speed commands change the game state outside of Game_Step, so the game is saved
+ * again by Save_State_Checkpoint when the console closes, and a resumed game places the same food.
+ *
+ * The console is fed one key at a time from the Input_Queue, so it never waits for a whole line
+ * and the main loop keeps running while the game is paused.
+ *
+ * @note The grid size is fixed at build time since it sets the size of the game arrays.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef debug_console_header
+#define debug_console_header
+#include <stdint.h>
+#include <stdbool.h>
+
+// Longest command line, not counting the terminating null character
+#define DEBUG_CONSOLE_LINE_SIZE 40
+
+// Number of logic ticks and board frames timed by the bench command
+#define DEBUG_CONSOLE_BENCH_TICKS 1000
+#define DEBUG_CONSOLE_BENCH_FRAMES 20
+
+/**
+ * @brief The Debug_Console_Open function pauses the game and prints the console prompt below the board.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Debug_Console_Open(void);
+
+/**
+ * @brief The Debug_Console_Active function checks if the console is open.
+ *
+ * @param None
+ *
+ * @return True while the console is open and the game is paused; false otherwise.
+ */
+bool Debug_Console_Active(void);
+
+/**
+ * @brief The Debug_Console_Key function handles one key typed in the console.
+ *
+ * Keys are echoed and added to the command line, backspace removes the last key, and
+ * carriage return runs the command. ESC closes the console.
+ *
+ * @param key The key read from the Input_Queue.
+ *
+ * @return None
+ */
+void Debug_Console_Key(char key);
+
+/**
+ * @brief The Debug_Console_Record_Tick function updates the tick counters shown by the stats command.
+ *
+ * @param work_cycles The cycles used by the input, logic, and render phases of the tick.
+ *
+ * @return None
+ */
+void Debug_Console_Record_Tick(uint32_t work_cycles);
+#endif
@@ -0,0 +1,125 @@
+/**
+ * @file Difficulty.c
+ *
+ * @brief Source code for the Difficulty driver.
+ *
+ * This file contains the function definitions and the curve tables of the Difficulty driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Difficulty.h"
+#include "Game_Logic.h"
+#include "Profiler.h"
+#include "UART0.h"
+
+// The snake speeds up with every point, quickly at first and then more and more slowly
+static const Difficulty_Level smooth_levels[] =
+{
+	{0, DIFFICULTY_US(200000), DIFFICULTY_US(4000)},
+	{40, DIFFICULTY_US(40000), DIFFICULTY_US(100)},
+	{140, DIFFICULTY_US(30000), DIFFICULTY_US(2)}
+};
+
+// The speed of the original game: 40 ms faster every 10 points, down to 40 ms
+static const Difficulty_Level classic_levels[] =
+{
+	{0, DIFFICULTY_US(200000), 0},
+	{10, DIFFICULTY_US(160000), 0},
+	{20, DIFFICULTY_US(120000), 0},
+	{30, DIFFICULTY_US(80000), 0},
+	{40, DIFFICULTY_US(40000), 0}
+};
+
+// One more tick per second every 10 points, from 5 to 20 ticks per second
+static const Difficulty_Level arcade_levels[] =
+{
+	{0, DIFFICULTY_TICKS_PER_SECOND(5), 0},
+	{10, DIFFICULTY_TICKS_PER_SECOND(6), 0},
+	{20, DIFFICULTY_TICKS_PER_SECOND(7), 0},
+	{30, DIFFICULTY_TICKS_PER_SECOND(8), 0},
+	{40, DIFFICULTY_TICKS_PER_SECOND(9), 0},
+	{50, DIFFICULTY_TICKS_PER_SECOND(10), 0},
+	{60, DIFFICULTY_TICKS_PER_SECOND(11), 0},
+	{70, DIFFICULTY_TICKS_PER_SECOND(12), 0},
+	{80, DIFFICULTY_TICKS_PER_SECOND(13), 0},
+	{90, DIFFICULTY_TICKS_PER_SECOND(14), 0},
+	{100, DIFFICULTY_TICKS_PER_SECOND(15), 0},
+	{120, DIFFICULTY_TICKS_PER_SECOND(16), 0},
+	{140, DIFFICULTY_TICKS_PER_SECOND(17), 0},
+	{160, DIFFICULTY_TICKS_PER_SECOND(18), 0},
+	{180, DIFFICULTY_TICKS_PER_SECOND(19), 0},
+	{200, DIFFICULTY_TICKS_PER_SECOND(20), 0}
+};
+
+#define DIFFICULTY_LEVEL_COUNT(levels) ((uint8_t)(sizeof(levels) / sizeof(levels[0])))
+
+const Difficulty_Curve difficulty_curves[DIFFICULTY_CURVE_COUNT] =
+{
+	{"smooth", smooth_levels, DIFFICULTY_LEVEL_COUNT(smooth_levels)},
+	{"classic", classic_levels, DIFFICULTY_LEVEL_COUNT(classic_levels)},
+	{"arcade", arcade_levels, DIFFICULTY_LEVEL_COUNT(arcade_levels)}
+};
+
+uint8_t difficulty_curve = DIFFICULTY_DEFAULT_CURVE;
+
+// Scores printed by Difficulty_Report
+static const uint16_t report_scores[] = {0, 10, 25, 50, 100, 200, 500, 1000, 5000};
+
+// Fraction of a cycle, in 1/256 cycle, that the previous ticks were short of their period
+static uint32_t cycle_remainder = 0;
+
+static uint32_t Difficulty_Curve_Period(const Difficulty_Curve *curve, uint32_t score)
+{
+	// The curves only have a few levels, so a linear search is enough
+	uint8_t level = 0;
+	while (level + 1 < curve->level_count && curve->levels[level + 1].first_score <= score)
+	{
+		level++;
+	}
+	
+	uint32_t period = curve->levels[level].period;
+	uint32_t speed_up = (score - curve->levels[level].first_score) * curve->levels[level].speed_up;
+	if (speed_up + DIFFICULTY_MINIMUM_PERIOD >= period)
+	{
+		return DIFFICULTY_MINIMUM_PERIOD;
+	}
+	return period - speed_up;
+}
+
+uint32_t Difficulty_Period(uint32_t score)
+{
+	return Difficulty_Curve_Period(&difficulty_curves[difficulty_curve], score);
+}
+
+uint32_t Difficulty_Tick_Cycles(uint32_t period)
+{
+	// The whole microseconds convert exactly; only the fraction needs to be carried
+	uint32_t fraction = ((period & 0xFF) * PROFILER_CYCLES_PER_US) + cycle_remainder;
+	cycle_remainder = fraction & 0xFF;
+	return ((period >> 8) * PROFILER_CYCLES_PER_US) + (fraction >> 8);
+}
+
+void Difficulty_Report(void)
+{
+	for (uint8_t i = 0; i < DIFFICULTY_CURVE_COUNT; i++)
+	{
+		// The selected curve is marked with an asterisk
+		UART0_Output_Unsigned_Decimal(i);
+		UART0_Output_String(i == difficulty_curve ? " * " : "   ");
+		UART0_Output_String((char *)difficulty_curves[i].name);
+		UART0_Output_String(" (score: period in us)");
+		for (uint8_t j = 0; j < sizeof(report_scores) / sizeof(report_scores[0]); j++)
+		{
+			if (report_scores[j] > WINNING_SCORE)
+			{
+				break;
+			}
+			UART0_Output_Character(' ');
+			UART0_Output_Unsigned_Decimal(report_scores[j]);
+			UART0_Output_Character(':');
+			UART0_Output_Unsigned_Decimal(Difficulty_Curve_Period(&difficulty_curves[i], report_scores[j]) >> 8);
+		}
+		UART0_Output_Newline();
+	}
+}
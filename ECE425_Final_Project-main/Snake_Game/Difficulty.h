@@ -0,0 +1,82 @@
+/**
+ * @file Difficulty.h
+ *
+ * @brief Header code for the Difficulty driver.
+ *
+ * This file contains the function definitions for the Difficulty driver.
+ * The speed of the snake follows a difficulty curve, a table of levels stored in flash.
+ * Each level starts at a score, with a tick period and the amount by which the period gets
+ * shorter with each point scored within the level, so a curve can have steps, ramps, or both.
+ *
+ * Periods are kept in 1/256 us (a fixed-point value with 8 fractional bits), so a level can be
+ * given as a number of ticks per second that does not divide one second evenly. Since Timer 0A
+ * counts whole cycles, Difficulty_Tick_Cycles carries the fraction of a cycle left over by each
+ * tick into the next one, so the average tick period matches the curve exactly.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef difficulty_header
+#define difficulty_header
+#include <stdint.h>
+
+// A period in us, or the period of a number of ticks per second, in 1/256 us
+#define DIFFICULTY_US(us) ((uint32_t)(us) * 256UL)
+#define DIFFICULTY_TICKS_PER_SECOND(ticks) (256000000UL / (ticks))
+
+// No curve can make a tick shorter than this, so the game stays playable over a terminal
+#define DIFFICULTY_MINIMUM_PERIOD DIFFICULTY_US(20000)
+
+#define DIFFICULTY_CURVE_COUNT 3
+#define DIFFICULTY_DEFAULT_CURVE 0
+
+typedef struct
+{
+	uint16_t first_score;   // Score at which the level starts
+	uint32_t period;        // Tick period at first_score, in 1/256 us
+	uint32_t speed_up;      // Amount removed from the period per point within the level, in 1/256 us
+} Difficulty_Level;
+
+typedef struct
+{
+	const char *name;
+	const Difficulty_Level *levels;
+	uint8_t level_count;
+} Difficulty_Curve;
+
+/**
+ * @brief The difficulty curves, and the index of the one used by the game. The levels of each
+ * curve are sorted by first_score, and the first one starts at 0.
+ */
+extern const Difficulty_Curve difficulty_curves[DIFFICULTY_CURVE_COUNT];
+extern uint8_t difficulty_curve;
+
+/**
+ * @brief The Difficulty_Period function looks up the tick period of a score on the selected curve.
+ *
+ * @param score The game score.
+ *
+ * @return The tick period in 1/256 us, never below DIFFICULTY_MINIMUM_PERIOD.
+ */
+uint32_t Difficulty_Period(uint32_t score);
+
+/**
+ * @brief The Difficulty_Tick_Cycles function converts a tick period into the whole number of
+ * cycles of the next tick. The fraction of a cycle that is left over is added to the next call.
+ *
+ * @param period The tick period in 1/256 us.
+ *
+ * @return The length of the next tick in system clock cycles.
+ */
+uint32_t Difficulty_Tick_Cycles(uint32_t period);
+
+/**
+ * @brief The Difficulty_Report function prints the tick period of each curve at a few scores
+ * up to WINNING_SCORE, so the curves can be compared on the serial terminal.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Difficulty_Report(void);
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file Display_Tables.c
+ *
+ * @brief Source code for the Display_Tables driver.
+ *
+ * This file contains the definitions of the constant tables used by the Game_Display driver.
+ * DISPLAY_FOR_EACH_NUMBER expands a macro once for every number from 1 to DISPLAY_TABLE_SIZE,
+ * and each number is turned into a string with the # operator, so no digits are formatted
+ * at runtime. The const qualifier keeps every table in flash.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Display_Tables.h"
+
+// Expands X for the ten numbers that start with the digits in prefix, e.g. 10 to 19
+#define DISPLAY_DECADE(X, prefix) \
+	X(prefix##0) X(prefix##1) X(prefix##2) X(prefix##3) X(prefix##4) \
+	X(prefix##5) X(prefix##6) X(prefix##7) X(prefix##8) X(prefix##9)
+
+// Expands X for every number from 1 to 139
+#define DISPLAY_FOR_EACH_NUMBER(X) \
+	X(1) X(2) X(3) X(4) X(5) X(6) X(7) X(8) X(9) \
+	DISPLAY_DECADE(X, 1) DISPLAY_DECADE(X, 2) DISPLAY_DECADE(X, 3) DISPLAY_DECADE(X, 4) \
+	DISPLAY_DECADE(X, 5) DISPLAY_DECADE(X, 6) DISPLAY_DECADE(X, 7) DISPLAY_DECADE(X, 8) \
+	DISPLAY_DECADE(X, 9) DISPLAY_DECADE(X, 10) DISPLAY_DECADE(X, 11) DISPLAY_DECADE(X, 12) \
+	DISPLAY_DECADE(X, 13)
+
+// The escape character is a separate string literal so that it does not absorb the digits
+#define DISPLAY_ROW_PREFIX(n)    { sizeof("\x1B" "[" #n ";") - 1, "\x1B" "[" #n ";" },
+#define DISPLAY_COLUMN_SUFFIX(n) { sizeof(#n "H") - 1, #n "H" },
+#define DISPLAY_STRING(text)     { sizeof(text) - 1, text }
+
+const Display_Sequence display_row_prefix[DISPLAY_TABLE_SIZE] =
+{
+	DISPLAY_FOR_EACH_NUMBER(DISPLAY_ROW_PREFIX)
+};
+
+const Display_Sequence display_column_suffix[DISPLAY_TABLE_SIZE] =
+{
+	DISPLAY_FOR_EACH_NUMBER(DISPLAY_COLUMN_SUFFIX)
+};
+
+const Display_String display_banner[DISPLAY_BANNER_LINES] =
+{
+	DISPLAY_STRING("UART Snake Game"),
+	DISPLAY_STRING("Use W, A, S, and D keys to control the moving snake."),
+	DISPLAY_STRING("The snake moves faster as you score! Can you fill the whole board?!")
+};
+
+const Display_String display_label_score = DISPLAY_STRING("Game Score: ");
+const Display_String display_label_delay = DISPLAY_STRING("Delay Speed: ");
+const Display_String display_label_frame_size = DISPLAY_STRING("Frame Size: ");
+const Display_String display_label_renderer = DISPLAY_STRING("Renderer: ");
@@ -0,0 +1,60 @@
+/**
+ * @file Display_Tables.h
+ *
+ * @brief Header code for the Display_Tables driver.
+ *
+ * This file contains the declarations of the constant tables used by the Game_Display driver.
+ * The tables are generated by the preprocessor at compile time and placed in flash, so that
+ * the renderer can copy an escape sequence with a table lookup instead of formatting the
+ * digits of every row and column at runtime.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef display_tables_header
+#define display_tables_header
+#include <stdint.h>
+
+// Number of rows and columns (starting at 1) that have an entry in the cursor tables
+#define DISPLAY_TABLE_SIZE 139
+
+// Number of lines in the banner at the top of the screen
+#define DISPLAY_BANNER_LINES 3
+
+typedef struct
+{
+	uint8_t length;
+	char text[7];
+} Display_Sequence;
+
+typedef struct
+{
+	uint8_t length;
+	const char *text;
+} Display_String;
+
+/**
+ * @brief The first half of a Cursor Position sequence for every row:
+ * display_row_prefix[n - 1] holds "ESC [ n ;".
+ */
+extern const Display_Sequence display_row_prefix[DISPLAY_TABLE_SIZE];
+
+/**
+ * @brief The second half of a Cursor Position sequence for every column:
+ * display_column_suffix[n - 1] holds "n H".
+ */
+extern const Display_Sequence display_column_suffix[DISPLAY_TABLE_SIZE];
+
+/**
+ * @brief The lines of the banner shown above the HUD, without line endings.
+ */
+extern const Display_String display_banner[DISPLAY_BANNER_LINES];
+
+/**
+ * @brief The labels of the HUD, without line endings.
+ */
+extern const Display_String display_label_score;
+extern const Display_String display_label_delay;
+extern const Display_String display_label_frame_size;
+extern const Display_String display_label_renderer;
+#endif
@@ -0,0 +1,53 @@
+/**
+ * @file EEPROM.c
+ *
+ * @brief Source code for the EEPROM driver.
+ *
+ * This file contains the function definitions for the EEPROM driver.
+ * More information about the timing of EEPROM accesses is on the header code of the EEPROM driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "EEPROM.h"
+
+// WORKING bit of the EEDONE register
+#define EEPROM_EEDONE_WORKING 0x01
+
+// PRETRY and ERETRY bits of the EESUPP register
+#define EEPROM_EESUPP_RETRY 0x0C
+
+void EEPROM_Init(void)
+{
+	// Enable the clock to the EEPROM module
+	SYSCTL->RCGCEEPROM |= 0x01;
+
+	// Wait until the EEPROM module is ready to be accessed
+	while ((SYSCTL->PREEPROM & 0x01) == 0);
+}
+
+bool EEPROM_Busy(void)
+{
+	return (EEPROM->EEDONE & EEPROM_EEDONE_WORKING) != 0;
+}
+
+bool EEPROM_Error(void)
+{
+	return (EEPROM->EESUPP & EEPROM_EESUPP_RETRY) != 0;
+}
+
+uint32_t EEPROM_Read_Word(uint8_t block, uint8_t offset)
+{
+	EEPROM->EEBLOCK = block;
+	EEPROM->EEOFFSET = offset;
+	return EEPROM->EERDWR;
+}
+
+void EEPROM_Write_Word(uint8_t block, uint8_t offset, uint32_t data)
+{
+	EEPROM->EEBLOCK = block;
+	EEPROM->EEOFFSET = offset;
+
+	// Writing EERDWR starts the program operation, which sets the WORKING bit until it is done
+	EEPROM->EERDWR = data;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file EEPROM.h
+ *
+ * @brief Header code for the EEPROM driver.
+ *
+ * This file contains the function definitions for the EEPROM driver.
+ * The TM4C123GH6PM has 2 KB of on-chip EEPROM, organized as 32 blocks of 16 words (32 bits each).
+ * A word is addressed by its block (EEBLOCK) and its offset in the block (EEOFFSET).
+ *
+ * Reading a word is fast, but programming a word takes milliseconds. EEPROM_Write_Word only starts
+ * the program operation and returns, so the caller must wait until EEPROM_Busy returns false before
+ * the next access. This lets long writes be spread over calls made while the game is not running.
+ *
+ * @note For more information regarding the EEPROM, refer to the Internal Memory section
+ * of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef eeprom_header
+#define eeprom_header
+#include "TM4C123GH6PM.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define EEPROM_BLOCK_COUNT 32
+#define EEPROM_WORDS_PER_BLOCK 16
+
+/**
+ * @brief The EEPROM_Init function enables the clock to the EEPROM module.
+ *
+ * After a reset, the EEPROM module may still be finishing an operation that was interrupted by
+ * a power loss, so EEPROM_Busy must return false before the EEPROM is used. This function
+ * does not wait for it.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EEPROM_Init(void);
+
+/**
+ * @brief The EEPROM_Busy function checks the WORKING bit of the EEDONE register.
+ *
+ * @param None
+ *
+ * @return True if the EEPROM is programming or recovering; false if it can be accessed.
+ */
+bool EEPROM_Busy(void);
+
+/**
+ * @brief The EEPROM_Error function checks the EESUPP register for a failed erase or program
+ * operation that could not be recovered.
+ *
+ * @param None
+ *
+ * @return True if the EEPROM cannot be used; false otherwise.
+ */
+bool EEPROM_Error(void);
+
+/**
+ * @brief The EEPROM_Read_Word function reads one word.
+ *
+ * @param block The block number (0 - 31).
+ * @param offset The word offset in the block (0 - 15).
+ *
+ * @return The word that was read.
+ */
+uint32_t EEPROM_Read_Word(uint8_t block, uint8_t offset);
+
+/**
+ * @brief The EEPROM_Write_Word function starts programming one word and returns without waiting.
+ *
+ * @param block The block number (0 - 31).
+ * @param offset The word offset in the block (0 - 15).
+ * @param data The word to write.
+ *
+ * @return None
+ */
+void EEPROM_Write_Word(uint8_t block, uint8_t offset, uint32_t data);
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file Event_Trace.c
+ *
+ * @brief Source code for the Event_Trace driver.
+ *
+ * This file contains the function definitions for the Event_Trace driver.
+ * More information about the event and dump formats is on the header code of the Event_Trace driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Event_Trace.h"
+#include "UART0.h"
+#include "CRC16.h"
+#include "COBS.h"
+
+#define EVENT_TRACE_MASK (EVENT_TRACE_SIZE - 1)
+#define EVENT_TRACE_EVENT_BYTES 8
+#define EVENT_TRACE_CHUNK_BYTES (4 + (EVENT_TRACE_EVENTS_PER_CHUNK * EVENT_TRACE_EVENT_BYTES) + 2)
+
+typedef struct
+{
+	uint32_t cycles;
+	uint8_t type;
+	uint8_t data;
+	uint16_t value;
+} Trace_Event;
+
+static Trace_Event events[EVENT_TRACE_SIZE];
+static uint32_t event_count = 0;
+
+// One chunk of the dump before and after COBS encoding
+static uint8_t chunk[EVENT_TRACE_CHUNK_BYTES];
+static uint8_t encoded[COBS_MAX_ENCODED(EVENT_TRACE_CHUNK_BYTES) + 1];
+
+void Event_Trace_Record(uint32_t cycles, uint8_t type, uint8_t data, uint16_t value)
+{
+	Trace_Event *event = &events[event_count & EVENT_TRACE_MASK];
+	event->cycles = cycles;
+	event->type = type;
+	event->data = data;
+	event->value = value;
+	event_count++;
+}
+
+void Event_Trace_Dump(void)
+{
+	uint32_t first = 0;
+	uint32_t count = event_count;
+	if (count > EVENT_TRACE_SIZE)
+	{
+		first = count - EVENT_TRACE_SIZE;
+	}
+	uint32_t chunk_count = ((count - first) + EVENT_TRACE_EVENTS_PER_CHUNK - 1) / EVENT_TRACE_EVENTS_PER_CHUNK;
+
+	// The text printed before the dump does not end with a 0x00 byte, so one is sent first.
+	// Otherwise the text would be read as the start of the first chunk, which would fail its CRC.
+	UART0_Output_Character(0x00);
+
+	for (uint32_t chunk_index = 0; chunk_index < chunk_count; chunk_index++)
+	{
+		uint16_t length = 4;
+		uint32_t start = first + (chunk_index * EVENT_TRACE_EVENTS_PER_CHUNK);
+		uint32_t end = start + EVENT_TRACE_EVENTS_PER_CHUNK;
+		if (end > count)
+		{
+			end = count;
+		}
+
+		chunk[0] = EVENT_TRACE_MSG_DUMP;
+		chunk[1] = chunk_index;
+		chunk[2] = chunk_count;
+		chunk[3] = end - start;
+		for (uint32_t i = start; i < end; i++)
+		{
+			Trace_Event *event = &events[i & EVENT_TRACE_MASK];
+			chunk[length++] = event->cycles & 0xFF;
+			chunk[length++] = (event->cycles >> 8) & 0xFF;
+			chunk[length++] = (event->cycles >> 16) & 0xFF;
+			chunk[length++] = (event->cycles >> 24) & 0xFF;
+			chunk[length++] = event->type;
+			chunk[length++] = event->data;
+			chunk[length++] = event->value & 0xFF;
+			chunk[length++] = event->value >> 8;
+		}
+
+		uint16_t crc = CRC16_Update(CRC16_INITIAL, chunk, length);
+		chunk[length++] = crc & 0xFF;
+		chunk[length++] = crc >> 8;
+
+		uint16_t encoded_length = COBS_Encode(chunk, length, encoded);
+		encoded[encoded_length++] = 0x00;
+		UART0_Output_Buffer((const char *)encoded, encoded_length);
+	}
+}
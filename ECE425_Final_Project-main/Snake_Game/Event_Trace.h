@@ -0,0 +1,92 @@
+/**
+ * @file Event_Trace.h
+ *
+ * @brief Header code for the Event_Trace driver.
+ *
+ * This file contains the function definitions for the Event_Trace driver.
+ * The Event_Trace driver always keeps the last EVENT_TRACE_SIZE game events in RAM, so the ticks
+ * that led to a game over can be examined afterwards. Each event is 8 bytes:
+ *
+ *  Byte(s)     Field
+ *  0 to 3      DWT cycle count when the event happened (20 ns per cycle)
+ *  4           Event type (EVENT_TRACE_ values below)
+ *  5           Data byte
+ *  6, 7        Value
+ *
+ *  Type                        Data                    Value
+ *  EVENT_TRACE_GAME_START      0                       Head cell
+ *  EVENT_TRACE_KEY             Key                     Input source
+ *  EVENT_TRACE_DIRECTION       New direction           Head cell
+ *  EVENT_TRACE_MOVE            Direction               Head cell after the move
+ *  EVENT_TRACE_GROW            0                       Snake length
+ *  EVENT_TRACE_FOOD            0                       Food cell
+ *  EVENT_TRACE_COLLISION       Direction               Head cell
+ *  EVENT_TRACE_OVERRUN         0                       Work time of the tick in units of 10 us
+ *
+ * A cell is y * GRID_WIDTH + x. Key events use the time at which the key was received by the
+ * interrupt, so the delay until it was applied can be seen.
+ *
+ * Event_Trace_Dump sends a 0x00 byte, then the events, oldest first, as Game_Protocol style
+ * messages: each one has the layout below, followed by its CRC-16/CCITT-FALSE (low byte first),
+ * and is COBS-encoded and terminated by a 0x00 byte.
+ *
+ *  Byte(s)     Field
+ *  0           EVENT_TRACE_MSG_DUMP
+ *  1           Chunk index (0 to chunk count - 1)
+ *  2           Chunk count
+ *  3           Number of events in this chunk (up to EVENT_TRACE_EVENTS_PER_CHUNK)
+ *  4 to n-1    The events, in the format above
+ *
+ * The event_timeline program in Host_Tools prints the dump as one line per event.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef event_trace_header
+#define event_trace_header
+#include "Profiler.h"
+#include <stdint.h>
+
+// Number of events kept in RAM; it must be a power of two. The oldest events are overwritten.
+#define EVENT_TRACE_SIZE 256
+#define EVENT_TRACE_EVENTS_PER_CHUNK 32
+
+#define EVENT_TRACE_MSG_DUMP 0x20
+
+#define EVENT_TRACE_GAME_START  0x01
+#define EVENT_TRACE_KEY         0x02
+#define EVENT_TRACE_DIRECTION   0x03
+#define EVENT_TRACE_MOVE        0x04
+#define EVENT_TRACE_GROW        0x05
+#define EVENT_TRACE_FOOD        0x06
+#define EVENT_TRACE_COLLISION   0x07
+#define EVENT_TRACE_OVERRUN     0x08
+
+/**
+ * @brief Records an event at the current time.
+ */
+#define EVENT_TRACE(type, data, value) Event_Trace_Record(PROFILER_CYCLES(), (type), (data), (value))
+
+/**
+ * @brief The Event_Trace_Record function stores one event in the ring buffer.
+ *
+ * It is only called from the main loop, so the ring buffer is not shared with an interrupt.
+ *
+ * @param cycles The DWT cycle count of the event.
+ * @param type One of the EVENT_TRACE_ event types.
+ * @param data The data byte of the event.
+ * @param value The value of the event.
+ *
+ * @return None
+ */
+void Event_Trace_Record(uint32_t cycles, uint8_t type, uint8_t data, uint16_t value);
+
+/**
+ * @brief The Event_Trace_Dump function sends the recorded events through UART0 in binary form.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Event_Trace_Dump(void);
+#endif
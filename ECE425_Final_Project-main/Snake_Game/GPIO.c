@@ -16,6 +16,8 @@
  */
 
 #include "GPIO.h"
+#include "Profiler.h"
+#include "Input_Queue.h"
 
 // Constant definitions for the user LED (RGB) colors
 const uint8_t RGB_LED_OFF 		= 0x00;
@@ -27,6 +29,9 @@ const uint8_t RGB_LED_GREEN 	= 0x08;
 const uint8_t EDUBASE_LED_ALL_OFF = 0x0;
 const uint8_t EDUBASE_LED_ALL_ON	= 0xF;
 
+// DWT cycle count of the last edge (press or release) of each EduBase button (PD0 - PD3)
+static uint32_t last_button_edge[4];
+
 void RGB_LED_Init(void)
 {
 	// Enable the clock to Port F
@@ -107,3 +112,48 @@ uint8_t Get_EduBase_Button_Status(void)
 	uint8_t button_status = GPIOD->DATA & 0x0F;
 	return button_status;
 }
+
+void EduBase_Button_Interrupt_Init(void)
+{
+	EduBase_Button_Init();
+	
+	// Configure PD0, PD1, PD2, and PD3 to detect edges by clearing the bits in the IS register
+	GPIOD->IS &= ~0x0F;
+	
+	// Detect both edges by setting the bits in the IBE register, so that the bounces of a release
+	// also restart the debounce time
+	GPIOD->IBE |= 0x0F;
+	
+	// Clear any pending interrupts, then unmask the interrupts in the IM register
+	GPIOD->ICR = 0x0F;
+	GPIOD->IM |= 0x0F;
+	
+	NVIC_SetPriority(GPIOD_IRQn, INPUT_INTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(GPIOD_IRQn);
+}
+
+void GPIOD_Handler(void)
+{
+	uint8_t edges = GPIOD->MIS & 0x0F;
+	uint8_t pressed = GPIOD->DATA & 0x0F;
+	uint32_t now = PROFILER_CYCLES();
+	
+	// Clear the interrupts that are being handled
+	GPIOD->ICR = edges;
+	
+	for (int i = 0; i < 4; i++)
+	{
+		uint8_t button = 1 << i;
+		if (edges & button)
+		{
+			// A press is accepted only if the button was quiet for the whole debounce time
+			bool quiet = (now - last_button_edge[i]) >= (EDUBASE_BUTTON_DEBOUNCE_MS * PROFILER_CYCLES_PER_MS);
+			last_button_edge[i] = now;
+			
+			if (quiet && (pressed & button))
+			{
+				Input_Queue_Push(button, INPUT_SOURCE_BUTTON);
+			}
+		}
+	}
+}
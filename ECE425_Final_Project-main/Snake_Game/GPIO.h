@@ -24,6 +24,9 @@ extern const uint8_t RGB_LED_RED;
 extern const uint8_t RGB_LED_BLUE;
 extern const uint8_t RGB_LED_GREEN;
 
+// Time that an EduBase button must be quiet (no edges) before a press is accepted
+#define EDUBASE_BUTTON_DEBOUNCE_MS 20
+
 // Constant definitions for the EduBase board LEDs
 extern const uint8_t EDUBASE_LED_ALL_OFF;
 extern const uint8_t EDUBASE_LED_ALL_ON;
@@ -144,3 +147,31 @@ void EduBase_Button_Init(void);
  *  - 0x08: SW2 is pressed
  */
 uint8_t Get_EduBase_Button_Status(void);
+
+/**
+ * @brief The EduBase_Button_Interrupt_Init function initializes the EduBase Board buttons (SW2 - SW5)
+ * to generate an interrupt when they are pressed.
+ *
+ * This function calls EduBase_Button_Init, then configures PD0 - PD3 to interrupt on both edges,
+ * which occur when a button is pressed and released. The interrupt has the same priority as the UART0 receive
+ * interrupt since both push into the Input_Queue.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_Button_Interrupt_Init(void);
+
+/**
+ * @brief The GPIOD_Handler function is the interrupt service routine for the EduBase Board buttons.
+ *
+ * A contact bounces for a few milliseconds after a press or a release, which causes more edges.
+ * An edge is only accepted as a press if the button reads as pressed and if the same button had no
+ * other edge during the last EDUBASE_BUTTON_DEBOUNCE_MS, so the bounces are ignored. Accepted presses are pushed into the
+ * Input_Queue with the button bit (0x01 - 0x08) as the key.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void GPIOD_Handler(void);
\ No newline at end of file
@@ -8,42 +8,509 @@
  *
  * @author Samira Cordero-Morales
 */
- 
+
 #include "Game_Logic.h"
 #include "Game_Display.h"
+#include "Game_Protocol.h"
 #include "UART0.h"
+#include "Profiler.h"
+#include "Display_Tables.h"
+#include "Multi_Snake.h"
+#include "Level_Pack.h"
 #include <stdbool.h>
+#include <string.h>
 
-void Draw_Game(void)
+// Screen row (starting at 1) of the first row of the board. The rows above it hold the HUD.
+#define DISPLAY_SCORE_ROW 5
+#define DISPLAY_DELAY_ROW 6
+#define DISPLAY_FRAME_SIZE_ROW 7
+#define DISPLAY_BOARD_ROW 9
+
+#if (DISPLAY_BOARD_ROW + GRID_HEIGHT) > DISPLAY_TABLE_SIZE || GRID_WIDTH > DISPLAY_TABLE_SIZE
+#error "The board does not fit in the cursor tables of Display_Tables.h"
+#endif
+
+// Large enough for a literal full redraw: the HUD, every cell, and the line endings.
+// On the large board, a full redraw is sent in pieces rather than using that much RAM.
+#if (384 + ((GRID_WIDTH + 5) * GRID_HEIGHT)) > 2048
+#define DISPLAY_FRAME_BUFFER_SIZE 2048
+#else
+#define DISPLAY_FRAME_BUFFER_SIZE (384 + ((GRID_WIDTH + 5) * GRID_HEIGHT))
+#endif
+
+// ESC [ ? 2 0 2 6 h and ESC [ ? 2 0 2 6 l
+#define DISPLAY_SYNC_SEQUENCE_BYTES 16
+
+Render_Mode render_mode = RENDER_MODE_FULL_REDRAW;
+
+// TeraTerm supports REP, so it is enabled until a terminal probe says otherwise
+uint8_t display_capabilities = DISPLAY_CAP_REP;
+
+// Bytes sent for the last frame, and the bytes that the same frame would take without REP
+uint32_t frame_bytes_sent = GRID_WIDTH * GRID_HEIGHT;
+uint32_t frame_bytes_literal = GRID_WIDTH * GRID_HEIGHT;
+uint32_t frame_bytes_sync = 0;
+uint32_t frame_assembly_us = 0;
+
+// Each frame is assembled here and sent to UART0 in one piece
+static char frame_buffer[DISPLAY_FRAME_BUFFER_SIZE];
+static uint16_t frame_length = 0;
+
+// Bytes saved by REP in the current frame, the size of the frame before it for the HUD,
+// and the literal size of the last full redraw
+static uint32_t frame_bytes_saved = 0;
+static uint32_t previous_frame_bytes = GRID_WIDTH * GRID_HEIGHT;
+static uint32_t previous_frame_literal = GRID_WIDTH * GRID_HEIGHT;
+static uint32_t full_redraw_literal_bytes = GRID_WIDTH * GRID_HEIGHT;
+
+// What is currently on the screen, so that the cursor delta renderer only sends changes
+static bool full_redraw_pending = true;
+static Cell drawn_food;
+static uint32_t drawn_score;
+static uint32_t drawn_delay_ms;
+
+// Set by Display_Benchmark so that the frames it assembles are never sent
+static bool frame_discard = false;
+
+static void Display_Flush(void)
 {
-	UART0_Output_Newline();
-	for (int y = 0; y < GRID_HEIGHT; y++)
+	if (!frame_discard)
 	{
-		for (int x = 0; x < GRID_WIDTH; x++)
+		UART0_Output_Buffer(frame_buffer, frame_length);
+	}
+	frame_length = 0;
+}
+
+static void Display_Output_Character(char data)
+{
+	// A frame that does not fit is sent in pieces rather than dropped
+	if (frame_length == DISPLAY_FRAME_BUFFER_SIZE)
+	{
+		Display_Flush();
+	}
+	frame_buffer[frame_length++] = data;
+	frame_bytes_sent++;
+}
+
+static void Display_Output_Bytes(const char *data, uint16_t length)
+{
+	if (frame_length + length > DISPLAY_FRAME_BUFFER_SIZE)
+	{
+		Display_Flush();
+	}
+	memcpy(&frame_buffer[frame_length], data, length);
+	frame_length += length;
+	frame_bytes_sent += length;
+}
+
+static void Display_Output_Table_String(const Display_String *string)
+{
+	Display_Output_Bytes(string->text, string->length);
+}
+
+static void Display_Output_String(char *pt)
+{
+	Display_Output_Bytes(pt, strlen(pt));
+}
+
+static bool Display_Overwrite_In_Place(void)
+{
+	// Without synchronized output, clearing the screen first makes the terminal flicker, so
+	// a full redraw overwrites the old frame and erases what is left of each line instead
+	return (display_capabilities & DISPLAY_CAP_CURSOR) && !(display_capabilities & DISPLAY_CAP_SYNC);
+}
+
+static void Display_Output_Newline(void)
+{
+	if (Display_Overwrite_In_Place())
+	{
+		Display_Output_String("\x1B[K");
+	}
+	Display_Output_Character(UART0_CR);
+	Display_Output_Character(UART0_LF);
+}
+
+static int Display_Count_Digits(uint32_t n)
+{
+	int digits = 1;
+	while (n >= 10)
+	{
+		n /= 10;
+		digits++;
+	}
+	return digits;
+}
+
+static void Display_Output_Decimal(uint32_t n)
+{
+	if (n >= 10)
+	{
+		Display_Output_Decimal(n / 10);
+		n = n % 10;
+	}
+	Display_Output_Character(n + '0');
+}
+
+static void Display_Move_Cursor(uint32_t row, uint32_t column)
+{
+	// ESC [ row ; column H, where the top left corner is row 1 and column 1
+	const Display_Sequence *prefix = &display_row_prefix[row - 1];
+	const Display_Sequence *suffix = &display_column_suffix[column - 1];
+	Display_Output_Bytes(prefix->text, prefix->length);
+	Display_Output_Bytes(suffix->text, suffix->length);
+}
+
+static void Display_Draw_Cell(Cell cell, char glyph)
+{
+	Display_Move_Cursor(DISPLAY_BOARD_ROW + CELL_Y(cell), 1 + CELL_X(cell));
+	Display_Output_Character(glyph);
+}
+
+static char Display_Cell_Glyph(Cell cell)
+{
+	// In a game with several snakes, the shared grid tells which snake is in the cell
+	if (multi_snake_count != 0)
+	{
+		uint8_t owner = Multi_Snake_Owner(cell);
+		if (owner != 0)
 		{
-			bool printed = false;
-			
-			for (int l = 0; l < snake_length; l++)
+			return multi_snake_glyph[owner - 1];
+		}
+	}
+	else if (Cell_Occupied(cell))
+	{
+		return 'O';
+	}
+
+	if (food == cell)
+	{
+		return '*';
+	}
+	return '.';
+}
+
+static void Display_Output_Run(char glyph, int run_length)
+{
+	// The glyph is always printed once since REP repeats the preceding character
+	Display_Output_Character(glyph);
+	int repeats = run_length - 1;
+	int sequence_length = 3 + Display_Count_Digits(repeats);
+
+	// ESC [ n b costs 3 bytes plus the digits of n, so it is only used when it is shorter
+	if ((display_capabilities & DISPLAY_CAP_REP) && repeats > sequence_length)
+	{
+		Display_Output_Character(UART0_ESC);
+		Display_Output_Character('[');
+		Display_Output_Decimal(repeats);
+		Display_Output_Character('b');
+		frame_bytes_saved += repeats - sequence_length;
+	}
+	else
+	{
+		for (int i = 0; i < repeats; i++)
+		{
+			Display_Output_Character(glyph);
+		}
+	}
+}
+
+static void Display_Output_Score(void)
+{
+	if (multi_snake_count == 0)
+	{
+		Display_Output_Decimal(game_score);
+		return;
+	}
+
+	// Each snake is named by its glyph, followed by its score
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		if (i != 0)
+		{
+			Display_Output_String("  ");
+		}
+		Display_Output_Character(multi_snake_glyph[i]);
+		Display_Output_Character(' ');
+		Display_Output_Decimal(multi_snake_score[i]);
+	}
+}
+
+static void Display_Output_Renderer_Name(void)
+{
+	if (render_mode == RENDER_MODE_CURSOR_DELTA)
+	{
+		Display_Output_String("cursor deltas");
+	}
+	else
+	{
+		Display_Output_String("full redraw");
+	}
+
+	if (display_capabilities & DISPLAY_CAP_REP)
+	{
+		Display_Output_String(" + REP");
+	}
+
+	if (display_capabilities & DISPLAY_CAP_SYNC)
+	{
+		Display_Output_String(" + sync (");
+		Display_Output_Decimal(DISPLAY_SYNC_SEQUENCE_BYTES);
+		Display_Output_String(" bytes per frame)");
+	}
+}
+
+static void Display_Output_Frame_Size(void)
+{
+	// The frame size line reports the frame before the one being drawn
+	Display_Output_Decimal(previous_frame_bytes);
+	Display_Output_String(" bytes (");
+	Display_Output_Decimal((previous_frame_bytes * 100) / previous_frame_literal);
+	Display_Output_String("% of a literal full redraw), built in ");
+	Display_Output_Decimal(frame_assembly_us);
+	Display_Output_String(" us");
+}
+
+static void Display_Full_Redraw(uint32_t snake_delay_ms)
+{
+	frame_bytes_saved = 0;
+
+	if (!Display_Overwrite_In_Place())
+	{
+		Display_Output_String("\x1B[2J"); // Clears TeraTerm screen
+	}
+	Display_Output_String("\x1B[H"); // Place cursor on top left before printing
+
+	for (int i = 0; i < DISPLAY_BANNER_LINES; i++)
+	{
+		Display_Output_Table_String(&display_banner[i]);
+		Display_Output_Newline();
+	}
+	Display_Output_Newline();
+
+	Display_Output_Table_String(&display_label_score);
+	Display_Output_Score();
+	Display_Output_Newline();
+	Display_Output_Table_String(&display_label_delay);
+	Display_Output_Decimal(snake_delay_ms);
+	Display_Output_String(" ms");
+	Display_Output_Newline();
+
+	Display_Output_Table_String(&display_label_frame_size);
+	Display_Output_Frame_Size();
+	Display_Output_Newline();
+	Display_Output_Table_String(&display_label_renderer);
+	Display_Output_Renderer_Name();
+
+	Draw_Game();
+
+	// Erase anything left below the board from the previous screen
+	if (Display_Overwrite_In_Place())
+	{
+		Display_Output_String("\x1B[J");
+	}
+
+	full_redraw_literal_bytes = frame_bytes_sent + frame_bytes_saved;
+	frame_bytes_literal = full_redraw_literal_bytes;
+
+	drawn_food = food;
+	drawn_score = game_score;
+	drawn_delay_ms = snake_delay_ms;
+	full_redraw_pending = false;
+}
+
+static void Display_Cursor_Delta(uint32_t snake_delay_ms, bool snake_grew)
+{
+	if (multi_snake_count != 0)
+	{
+		// Every tail is erased before any head is drawn, since a head may take the cell
+		// that another tail just left. A snake that crashed is erased by a full redraw.
+		for (uint8_t i = 0; i < multi_snake_count; i++)
+		{
+			if (multi_snake_alive[i] && !multi_snake_grew[i])
 			{
-				if (snake[l].x == x && snake[l].y == y)
-				{
-					UART0_Output_Character('O');
-					printed = true;
-					break;
-				}
+				Display_Draw_Cell(multi_snake_last_tail[i], '.');
 			}
-			
-			if (food.x == x && food.y == y)
+		}
+		for (uint8_t i = 0; i < multi_snake_count; i++)
+		{
+			if (multi_snake_alive[i])
 			{
-				UART0_Output_Character('*');
-				printed = true;
+				Display_Draw_Cell(multi_snake_head[i], multi_snake_glyph[i]);
 			}
-			
-			if (!printed)
+		}
+	}
+	else
+	{
+		// The tail keeps its cell on the tick that the snake grows
+		if (!snake_grew)
+		{
+			Display_Draw_Cell(last_tail, '.');
+		}
+		Display_Draw_Cell(snake_head, 'O');
+	}
+
+	if (food != drawn_food)
+	{
+		Display_Draw_Cell(food, '*');
+		drawn_food = food;
+	}
+
+	// The HUD is only rewritten when the score changes to keep each delta small
+	if (game_score != drawn_score)
+	{
+		Display_Move_Cursor(DISPLAY_SCORE_ROW, 1 + display_label_score.length);
+		Display_Output_Score();
+		Display_Output_String("\x1B[K");
+		Display_Move_Cursor(DISPLAY_FRAME_SIZE_ROW, 1 + display_label_frame_size.length);
+		Display_Output_Frame_Size();
+		Display_Output_String("\x1B[K");
+		drawn_score = game_score;
+	}
+
+	if (snake_delay_ms != drawn_delay_ms)
+	{
+		Display_Move_Cursor(DISPLAY_DELAY_ROW, 1 + display_label_delay.length);
+		Display_Output_Decimal(snake_delay_ms);
+		Display_Output_String(" ms\x1B[K");
+		drawn_delay_ms = snake_delay_ms;
+	}
+
+	frame_bytes_literal = full_redraw_literal_bytes;
+}
+
+void Display_Reset(void)
+{
+	full_redraw_pending = true;
+
+	if (render_mode == RENDER_MODE_BINARY)
+	{
+		Protocol_Init();
+	}
+}
+
+void Draw_Frame(uint32_t snake_delay_ms, bool snake_grew)
+{
+	if (render_mode == RENDER_MODE_BINARY)
+	{
+		// In binary mode, only the cells that changed are sent to the host renderer
+		if (full_redraw_pending)
+		{
+			Protocol_Send_Keyframe();
+			full_redraw_pending = false;
+		}
+		else
+		{
+			Protocol_Send_Delta(snake_grew);
+		}
+		return;
+	}
+
+	uint32_t start_cycles = PROFILER_CYCLES();
+	previous_frame_bytes = frame_bytes_sent;
+	previous_frame_literal = frame_bytes_literal;
+	frame_bytes_sent = 0;
+	frame_bytes_sync = 0;
+
+	// Ask the terminal to present the whole frame at once
+	if (display_capabilities & DISPLAY_CAP_SYNC)
+	{
+		Display_Output_String("\x1B[?2026h");
+	}
+
+	if (full_redraw_pending || render_mode == RENDER_MODE_FULL_REDRAW)
+	{
+		Display_Full_Redraw(snake_delay_ms);
+	}
+	else
+	{
+		Display_Cursor_Delta(snake_delay_ms, snake_grew);
+	}
+
+	if (display_capabilities & DISPLAY_CAP_SYNC)
+	{
+		Display_Output_String("\x1B[?2026l");
+		frame_bytes_sync = DISPLAY_SYNC_SEQUENCE_BYTES;
+	}
+
+	// The assembly time does not include the time spent waiting on the transmit FIFO
+	frame_assembly_us = Profiler_Cycles_To_us(PROFILER_CYCLES() - start_cycles);
+	Display_Flush();
+}
+
+uint32_t Display_Benchmark(uint16_t frames)
+{
+	uint32_t saved_bytes_sent = frame_bytes_sent;
+	uint32_t saved_bytes_saved = frame_bytes_saved;
+
+	frame_discard = true;
+	uint32_t start_cycles = PROFILER_CYCLES();
+	for (uint16_t i = 0; i < frames; i++)
+	{
+		Draw_Game();
+		Display_Flush();
+	}
+	uint32_t cycles = PROFILER_CYCLES() - start_cycles;
+	frame_discard = false;
+
+	frame_bytes_sent = saved_bytes_sent;
+	frame_bytes_saved = saved_bytes_saved;
+	return cycles / frames;
+}
+
+void Display_Move_Below_Board(void)
+{
+	if (render_mode == RENDER_MODE_CURSOR_DELTA)
+	{
+		UART0_Output_String("\x1B[");
+		UART0_Output_Unsigned_Decimal(DISPLAY_BOARD_ROW + GRID_HEIGHT);
+		UART0_Output_String(";1H");
+	}
+}
+
+void Draw_Row(const char *row, int length)
+{
+	int x = 0;
+	while (x < length)
+	{
+		int run_length = 1;
+		while (x + run_length < length && row[x + run_length] == row[x])
+		{
+			run_length++;
+		}
+		Display_Output_Run(row[x], run_length);
+		x += run_length;
+	}
+}
+
+void Draw_Game(void)
+{
+	char row[GRID_WIDTH];
+
+	// Cells are stored row by row, so the board is read with one index that only increments
+	uint16_t cell = 0;
+
+	Display_Output_Newline();
+	for (int y = 0; y < GRID_HEIGHT; y++)
+	{
+		// The walls come from the rows rendered by Level_Load, so only the other cells are looked up.
+		// The snakes of a game with several snakes ignore the walls.
+		if (multi_snake_count != 0)
+		{
+			memset(row, '.', GRID_WIDTH);
+		}
+		else
+		{
+			Level_Render_Row(y, row);
+		}
+		for (int x = 0; x < GRID_WIDTH; x++)
+		{
+			if (row[x] == '.')
 			{
-				UART0_Output_Character('.');
+				row[x] = Display_Cell_Glyph(cell);
 			}
+			cell++;
 		}
-		UART0_Output_Newline();
+		Draw_Row(row, GRID_WIDTH);
+		Display_Output_Newline();
 	}
-}
\ No newline at end of file
+}
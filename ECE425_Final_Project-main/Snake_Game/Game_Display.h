@@ -12,15 +12,130 @@
  
 #ifndef game_display_header
 #define game_display_header
+#include <stdint.h>
+#include <stdbool.h>
+
+// Terminal features that the ANSI renderer may use
+#define DISPLAY_CAP_REP     0x01
+#define DISPLAY_CAP_CURSOR  0x02
+#define DISPLAY_CAP_SYNC    0x04
+
+typedef enum
+{
+	RENDER_MODE_FULL_REDRAW,
+	RENDER_MODE_CURSOR_DELTA,
+	RENDER_MODE_BINARY
+} Render_Mode;
+
+/**
+ * @brief The current output mode.
+ *  - RENDER_MODE_FULL_REDRAW clears the terminal and redraws the HUD and board every tick.
+ *  - RENDER_MODE_CURSOR_DELTA redraws everything once, then moves the cursor to the cells that
+ *    changed (the head, the vacated tail, and the food) and rewrites only those.
+ *  - RENDER_MODE_BINARY sends Game_Protocol messages to a host-side renderer instead.
+ */
+extern Render_Mode render_mode;
+
+/**
+ * @brief Bit field of the DISPLAY_CAP_ flags supported by the terminal.
+ * If DISPLAY_CAP_REP is cleared, every cell is printed as a literal character.
+ * If DISPLAY_CAP_SYNC is set, each frame is wrapped in the synchronized output sequences.
+ */
+extern uint8_t display_capabilities;
+
+/**
+ * @brief Number of bytes sent for the last frame, and the number of bytes that a full redraw
+ * takes when every cell is printed literally.
+ */
+extern uint32_t frame_bytes_sent;
+extern uint32_t frame_bytes_literal;
+
+/**
+ * @brief Number of bytes of the last frame used by the synchronized output sequences,
+ * and the time taken to assemble the last frame in the frame buffer.
+ */
+extern uint32_t frame_bytes_sync;
+extern uint32_t frame_assembly_us;
+
+/**
+ * @brief The Display_Reset function makes the next call to Draw_Frame redraw everything.
+ * 
+ * It must be called after Game_Init so that the first frame of a game is a full redraw,
+ * or a keyframe in RENDER_MODE_BINARY.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Display_Reset(void);
+
+/**
+ * @brief The Draw_Frame function draws one frame with the current render mode.
+ * 
+ * The frame is assembled in a buffer and sent to UART0 only once it is complete. If the terminal
+ * supports DISPLAY_CAP_SYNC, the frame is wrapped in ESC [ ? 2 0 2 6 h and ESC [ ? 2 0 2 6 l so
+ * that the terminal presents it at once. Otherwise, a full redraw overwrites the previous frame
+ * in place instead of clearing the screen first.
+ * 
+ * The HUD shows the game score, the delay speed, the size of the last frame, and the
+ * renderer that is in use.
+ *
+ * @param snake_delay_ms The delay speed shown on the HUD.
+ * @param snake_grew True if the snake ate the food during this tick.
+ *
+ * @return None
+ */
+void Draw_Frame(uint32_t snake_delay_ms, bool snake_grew);
+
+/**
+ * @brief The Display_Move_Below_Board function moves the cursor to the line below the board,
+ * so that messages printed after the game do not overwrite it.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Display_Move_Below_Board(void);
+
+/**
+ * @brief The Display_Benchmark function measures how long it takes to assemble the board.
+ *
+ * The board is assembled with Draw_Game the given number of times, and the frames are discarded
+ * instead of being sent, so the result does not include the time spent waiting on UART0.
+ * The frame size counters shown on the HUD are not changed.
+ *
+ * @param frames The number of frames to assemble. It must be at least 1.
+ *
+ * @return The average number of cycles per frame.
+ */
+uint32_t Display_Benchmark(uint16_t frames);
+
+/**
+ * @brief The Draw_Row function prints one row of cells, collapsing runs of the same character.
+ * 
+ * When the terminal supports DISPLAY_CAP_REP, a run is printed as the character followed by
+ * the ANSI REP sequence (ESC [ n b), which repeats it n more times. The sequence is only used
+ * when it is shorter than the literal run; otherwise the characters are printed as they are.
+ *
+ * @param row Pointer to the characters of the row.
+ * @param length Number of characters in the row.
+ *
+ * @return None
+ */
+void Draw_Row(const char *row, int length);
+
 /**
  * @brief The Draw_Function function draws the grid of the snake game, the snake, and the food.
  * 
- * Boolean is used to check if a cell is filled with a 'O' or '*'. If neither, the program
- * fills the empty cell with a '.'.
+ * Each cell is filled with a 'O' or '*'. If neither, the program fills the empty cell with a '.'.
+ * The walls of the level are drawn with a '#'.
+ * In a game with several snakes (see the Multi_Snake driver), each snake is drawn with its own
+ * character from multi_snake_glyph, and the HUD shows the score of each snake.
+ * Every row is printed with Draw_Row, so long runs of empty cells are compressed.
  *
  * @param None
  *
  * @return None
  */
 void Draw_Game(void);
-#endif
\ No newline at end of file
+#endif
@@ -14,97 +14,428 @@
 */
 
 #include "Game_Logic.h"
-#include <stdlib.h>
+#include "Difficulty.h"
+#include "Level_Pack.h"
 #include <stdbool.h>
+#include <string.h>
 
-Coord food;
-Coord snake[MAX_SNAKE_LENGTH];
-uint8_t snake_length = 3;
+// Seed of the xorshift32 generator, which must not be 0
+#define GAME_RANDOM_SEED 2463534242UL
+
+// Number of random cells tried before Food_Init searches the occupancy bitmap for a free cell
+#define FOOD_RANDOM_ATTEMPTS 4
+
+// Set to 1 when a side of the board is not a power of two, so the neighbors of each cell
+// on a wrapped board are looked up in a table instead of being found with masks
+#define WRAP_NEIGHBOR_TABLE (((GRID_WIDTH & (GRID_WIDTH - 1)) != 0) || ((GRID_HEIGHT & (GRID_HEIGHT - 1)) != 0))
+
+Cell food;
+Cell snake_head;
+Cell snake_tail;
+uint8_t snake_occupancy[(GRID_CELLS + 7) / 8];
+Cell last_tail;
+uint16_t snake_length = 3;
 Direction current_direction = RIGHT;
 uint32_t game_score = 0;
+uint32_t snake_period;
+uint32_t snake_delay_ms;
+uint32_t random_state = GAME_RANDOM_SEED;
+bool board_wrap = false;
+
+// In the order of Direction: UP, DOWN, LEFT, RIGHT
+const int16_t cell_delta[4] = {-GRID_WIDTH, GRID_WIDTH, -1, 1};
+
+#if WRAP_NEIGHBOR_TABLE
+// The neighbor of each cell in each Direction on a wrapped board, built on the first game
+static Cell wrap_neighbor[GRID_CELLS][4];
+static bool wrap_neighbor_ready = false;
+#else
+// When both sides are powers of two, a move up or down wraps the whole cell index, and a move
+// left or right wraps the column bits and keeps the row bits. In the order of Direction.
+static const uint16_t wrap_keep[4] = {0, 0, (GRID_CELLS - 1) & ~(GRID_WIDTH - 1), (GRID_CELLS - 1) & ~(GRID_WIDTH - 1)};
+static const uint16_t wrap_mask[4] = {GRID_CELLS - 1, GRID_CELLS - 1, GRID_WIDTH - 1, GRID_WIDTH - 1};
+#endif
+
+#if SNAKE_DIRECTION_CHAIN
+// Ring buffer of 2-bit directions, four per byte. Entry chain_tail is the move from the tail
+// to the next segment, and the entries that follow lead to the head.
+static uint8_t snake_chain[(MAX_SNAKE_LENGTH + 3) / 4];
+static uint16_t chain_tail = 0;
+#else
+// Ring buffer of Cells. The head is snake_cells[cells_head], and the segments follow it at
+// increasing indexes until the tail.
+static Cell snake_cells[MAX_SNAKE_LENGTH];
+static uint16_t cells_head = 0;
+#endif
+
+// Set by Snake_Move when the head hits a wall or the body
+static bool snake_collision = false;
+
+static void Occupancy_Set(Cell cell)
+{
+	snake_occupancy[cell >> 3] |= 1 << (cell & 0x07);
+}
+
+static void Occupancy_Clear(Cell cell)
+{
+	snake_occupancy[cell >> 3] &= ~(1 << (cell & 0x07));
+}
+
+static void Game_Set_Speed(void)
+{
+	snake_period = Difficulty_Period(game_score);
+	snake_delay_ms = snake_period / DIFFICULTY_US(1000);
+}
+
+static uint16_t Ring_Index(uint32_t index)
+{
+	if (index >= MAX_SNAKE_LENGTH)
+	{
+		index -= MAX_SNAKE_LENGTH;
+	}
+	return index;
+}
+
+#if SNAKE_DIRECTION_CHAIN
+static void Chain_Write(uint16_t index, Direction direction)
+{
+	uint8_t shift = (index & 0x03) << 1;
+	snake_chain[index >> 2] = (snake_chain[index >> 2] & ~(0x03 << shift)) | (direction << shift);
+}
+
+static Direction Chain_Read(uint16_t index)
+{
+	return (Direction)((snake_chain[index >> 2] >> ((index & 0x03) << 1)) & 0x03);
+}
+#endif
+
+#if WRAP_NEIGHBOR_TABLE
+static void Wrap_Neighbor_Init(void)
+{
+	if (wrap_neighbor_ready)
+	{
+		return;
+	}
+	for (uint16_t cell = 0; cell < GRID_CELLS; cell++)
+	{
+		uint8_t x = CELL_X(cell);
+		uint8_t y = CELL_Y(cell);
+		wrap_neighbor[cell][UP] = CELL_OF(x, (y == 0) ? GRID_HEIGHT - 1 : y - 1);
+		wrap_neighbor[cell][DOWN] = CELL_OF(x, (y == GRID_HEIGHT - 1) ? 0 : y + 1);
+		wrap_neighbor[cell][LEFT] = CELL_OF((x == 0) ? GRID_WIDTH - 1 : x - 1, y);
+		wrap_neighbor[cell][RIGHT] = CELL_OF((x == GRID_WIDTH - 1) ? 0 : x + 1, y);
+	}
+	wrap_neighbor_ready = true;
+}
+#endif
+
+// The neighbor on a wrapped board, found without a branch. It is also the neighbor on a board with
+// walls for any move along the body, since the body never crosses an edge of such a board.
+static Cell Wrap_Neighbor(Cell cell, Direction direction)
+{
+#if WRAP_NEIGHBOR_TABLE
+	return wrap_neighbor[cell][direction];
+#else
+	return (cell & wrap_keep[direction]) | ((cell + cell_delta[direction]) & wrap_mask[direction]);
+#endif
+}
+
+Cell Cell_Neighbor(Cell cell, Direction direction)
+{
+	Cell next = Wrap_Neighbor(cell, direction);
+
+	// On a board with walls, a move that wraps around leaves the board
+	if (!board_wrap && next != cell + cell_delta[direction])
+	{
+		return CELL_NONE;
+	}
+	return next;
+}
+
+bool Cell_Occupied(Cell cell)
+{
+	return (snake_occupancy[cell >> 3] & (1 << (cell & 0x07))) != 0;
+}
 
 void Food_Init(void)
 {
-	food.x = rand() % GRID_WIDTH;
-	food.y = rand() % GRID_HEIGHT;
+	uint16_t free_cells = GRID_CELLS - snake_length - level_wall_count;
+	if (free_cells == 0)
+	{
+		// The snake fills the board, so the food is placed outside of it
+		food = CELL_NONE;
+		return;
+	}
+
+	for (int attempt = 0; attempt < FOOD_RANDOM_ATTEMPTS; attempt++)
+	{
+		food = Game_Random() % GRID_CELLS;
+		if (!Cell_Occupied(food) && Level_Food_Allowed(food))
+		{
+			return;
+		}
+	}
+
+	// Pick a random free cell by counting the free cells in the occupancy bitmap.
+	// The food rule of the level is not checked here, since no free cell may pass it.
+	uint16_t skip = Game_Random() % free_cells;
+	uint16_t cell = 0;
+	while (cell < GRID_CELLS)
+	{
+		// A full byte has no free cells, so all eight cells are skipped at once
+		if ((cell & 0x07) == 0 && snake_occupancy[cell >> 3] == 0xFF)
+		{
+			cell += 8;
+			continue;
+		}
+
+		if (!Cell_Occupied(cell))
+		{
+			if (skip == 0)
+			{
+				break;
+			}
+			skip--;
+		}
+		cell++;
+	}
+	food = (Cell)cell;
 }
 
-void Game_Init(void)
+void Game_Init_Snake_At(uint8_t x, uint8_t y, Direction direction)
 {
-	// Head of snake
-	snake[0].x = GRID_WIDTH / 2;
-	snake[0].y = GRID_HEIGHT / 2;
-	
-	// Body of snake
-	snake[1].x = (GRID_WIDTH / 2) - 1;
-	snake[1].y = (GRID_HEIGHT / 2) - 1;
-	
-	// Tail of snake
-	snake[2].x = (GRID_WIDTH / 2) - 2;
-	snake[2].y = (GRID_HEIGHT / 2) - 2;
+#if WRAP_NEIGHBOR_TABLE
+	Wrap_Neighbor_Init();
+#endif
+	memcpy(snake_occupancy, level_walls, sizeof(snake_occupancy));
+
+	// The head is at (x, y) and the body and tail are behind it
+	snake_head = CELL_OF(x, y);
+	snake_tail = snake_head - (INITIAL_SNAKE_LENGTH - 1) * cell_delta[direction];
+	for (int i = 0; i < INITIAL_SNAKE_LENGTH; i++)
+	{
+		Occupancy_Set(snake_head - i * cell_delta[direction]);
+#if SNAKE_DIRECTION_CHAIN
+		if (i < INITIAL_SNAKE_LENGTH - 1)
+		{
+			Chain_Write(i, direction);
+		}
+#else
+		snake_cells[i] = snake_head - i * cell_delta[direction];
+#endif
+	}
+#if SNAKE_DIRECTION_CHAIN
+	chain_tail = 0;
+#else
+	cells_head = 0;
+#endif
 	snake_length = INITIAL_SNAKE_LENGTH;
-	current_direction = RIGHT;
-	
+	current_direction = direction;
+	snake_collision = false;
+
 	Food_Init();
-	
+
 	game_score = 0;
+	Game_Set_Speed();
+}
+
+void Game_Init(void)
+{
+	const Level *level = &levels[level_selected];
+	Level_Load(level_selected);
+	Game_Init_Snake_At(level->spawn_x, level->spawn_y, level->direction);
+}
+
+bool Game_Won(void)
+{
+	return snake_length >= MAX_SNAKE_LENGTH - level_wall_count;
 }
 
 void Snake_Move(void)
 {
-	for (int i = snake_length - 1; i > 0; i--)
+	Cell next_head;
+	if (board_wrap)
 	{
-		snake[i] = snake[i - 1];
+		// Every cell has a neighbor in every direction, so there is no edge to check
+		next_head = Wrap_Neighbor(snake_head, current_direction);
 	}
-	
-	switch (current_direction)
+	else
 	{
-		case UP:
-		{
-			snake[0].y--; 
-			break;
-		}
-		case DOWN:
-		{
-			snake[0].y++; 
-			break;
-		}
-		case LEFT:
+		bool hits_wall = false;
+
+		// The walls are checked before the move since a cell index has no cells outside the board
+		switch (current_direction)
 		{
-			snake[0].x--; 
-			break;
+			case UP:
+			{
+				hits_wall = snake_head < GRID_WIDTH;
+				break;
+			}
+			case DOWN:
+			{
+				hits_wall = snake_head >= GRID_CELLS - GRID_WIDTH;
+				break;
+			}
+			case LEFT:
+			{
+				hits_wall = CELL_X(snake_head) == 0;
+				break;
+			}
+			case RIGHT:
+			{
+				hits_wall = CELL_X(snake_head) == GRID_WIDTH - 1;
+				break;
+			}
 		}
-		case RIGHT:
+
+		if (hits_wall)
 		{
-			snake[0].x++; 
-			break;
+			snake_collision = true;
+			return;
 		}
+		next_head = snake_head + cell_delta[current_direction];
+	}
+
+	// The tail leaves its cell before the head moves, so the head may follow the tail
+	last_tail = snake_tail;
+	Occupancy_Clear(last_tail);
+
+#if SNAKE_DIRECTION_CHAIN
+	// The move of the head is added to the head end of the chain, and the tail follows
+	// the oldest move in the chain
+	Chain_Write(Ring_Index(chain_tail + snake_length - 1), current_direction);
+	snake_tail = Wrap_Neighbor(snake_tail, Chain_Read(chain_tail));
+	chain_tail = Ring_Index(chain_tail + 1);
+#else
+	// Add the head to the front of the ring buffer; the segment before the old tail becomes the tail
+	if (cells_head == 0)
+	{
+		cells_head = MAX_SNAKE_LENGTH;
+	}
+	cells_head--;
+	snake_cells[cells_head] = next_head;
+	snake_tail = snake_cells[Ring_Index(cells_head + snake_length - 1)];
+#endif
+	snake_head = next_head;
+
+	if (Cell_Occupied(snake_head))
+	{
+		snake_collision = true;
 	}
+	Occupancy_Set(snake_head);
 }
 
 void Snake_Grow(void)
 {
 	if (snake_length < MAX_SNAKE_LENGTH)
 	{
-		snake[snake_length] = snake[snake_length - 1];
 		snake_length++;
+
+		// The tail moves back onto the cell it just left. Its Cell (or the move out of it)
+		// is still stored just behind the tail, since only the head end was written.
+#if SNAKE_DIRECTION_CHAIN
+		if (chain_tail == 0)
+		{
+			chain_tail = MAX_SNAKE_LENGTH;
+		}
+		chain_tail--;
+#endif
+		snake_tail = last_tail;
+		Occupancy_Set(last_tail);
+
 		game_score = snake_length - INITIAL_SNAKE_LENGTH;
 	}
 }
 
 bool Check_Collision(void)
 {
-	if (snake[0].x >= GRID_WIDTH || snake[0].y >= GRID_HEIGHT || snake[0].x <0 || snake[0].y <0)
+	return snake_collision;
+}
+
+uint32_t Game_Random(void)
+{
+	random_state ^= random_state << 13;
+	random_state ^= random_state >> 17;
+	random_state ^= random_state << 5;
+	return random_state;
+}
+
+bool Game_Step(void)
+{
+	Snake_Move();
+
+	// If the snake catches the food
+	if (!snake_collision && snake_head == food)
 	{
+		Snake_Grow();
+		Food_Init();
+
+		// Increase snake's speed as the difficulty curve says
+		Game_Set_Speed();
 		return true;
 	}
-	
-	for (int i = 1; i < snake_length; i++)
+	return false;
+}
+
+bool Snake_Save_Body(uint8_t *moves, uint16_t size)
+{
+	uint16_t move_count = snake_length - 1;
+	if ((move_count + 3) / 4 > size)
+	{
+		return false;
+	}
+
+	memset(moves, 0, (move_count + 3) / 4);
+#if SNAKE_DIRECTION_CHAIN
+	for (uint16_t i = 0; i < move_count; i++)
 	{
-		if (snake[0].x == snake[i].x && snake[0].y == snake[i].y)
+		moves[i >> 2] |= Chain_Read(Ring_Index(chain_tail + i)) << ((i & 0x03) << 1);
+	}
+#else
+	// The move between two segments is the direction in which the next segment is a neighbor
+	for (uint16_t i = 0; i < move_count; i++)
+	{
+		Cell from = snake_cells[Ring_Index(cells_head + snake_length - 1 - i)];
+		Cell to = snake_cells[Ring_Index(cells_head + snake_length - 2 - i)];
+		uint8_t direction = 0;
+		while (Wrap_Neighbor(from, (Direction)direction) != to)
 		{
-			return true;
+			direction++;
 		}
+		moves[i >> 2] |= direction << ((i & 0x03) << 1);
 	}
-	return false;
-}
\ No newline at end of file
+#endif
+	return true;
+}
+
+void Snake_Load_Body(Cell tail, uint16_t length, const uint8_t *moves)
+{
+#if WRAP_NEIGHBOR_TABLE
+	Wrap_Neighbor_Init();
+#endif
+	memcpy(snake_occupancy, level_walls, sizeof(snake_occupancy));
+	snake_length = length;
+	snake_tail = tail;
+	snake_head = tail;
+	Occupancy_Set(tail);
+#if SNAKE_DIRECTION_CHAIN
+	chain_tail = 0;
+#else
+	// The tail is at the end of the ring buffer and the head is at index 0
+	cells_head = 0;
+	snake_cells[length - 1] = tail;
+#endif
+
+	for (uint16_t i = 0; i < length - 1; i++)
+	{
+		Direction direction = (Direction)((moves[i >> 2] >> ((i & 0x03) << 1)) & 0x03);
+		snake_head = Wrap_Neighbor(snake_head, direction);
+		Occupancy_Set(snake_head);
+#if SNAKE_DIRECTION_CHAIN
+		Chain_Write(i, direction);
+#else
+		snake_cells[length - 2 - i] = snake_head;
+#endif
+	}
+	snake_collision = false;
+}
@@ -16,10 +16,25 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+// Set to 1 for the large board, where the snake can grow until it fills every cell.
+// The terminal needs at least 128 columns and 73 rows to show the large board.
+#ifndef LARGE_BOARD
+#define LARGE_BOARD 0
+#endif
+
+#if LARGE_BOARD
+#define GRID_WIDTH	128
+#define GRID_HEIGHT 64
+#else
 #define GRID_WIDTH	20
 #define GRID_HEIGHT 10
-#define MAX_SNAKE_LENGTH 50
+#endif
+
+// The game is won when the snake fills the board
+#define MAX_SNAKE_LENGTH (GRID_WIDTH * GRID_HEIGHT)
 #define INITIAL_SNAKE_LENGTH 3
+#define WINNING_SCORE (MAX_SNAKE_LENGTH - INITIAL_SNAKE_LENGTH)
+#define GRID_CELLS (GRID_WIDTH * GRID_HEIGHT)
 
 typedef enum 
 {
@@ -29,23 +44,85 @@ typedef enum
 	RIGHT
 } Direction;
 
-typedef struct
-{
-	uint8_t x;
-	uint8_t y;
-} Coord;
+/**
+ * @brief A cell of the board stored as a single index, y * GRID_WIDTH + x, so that a segment
+ * fits in one byte on boards of fewer than 256 cells. Moving one cell is an addition of
+ * cell_delta[direction], and both coordinates are only computed when a cell is drawn or sent.
+ * CELL_NONE is one past the last cell and marks a cell that is not on the board.
+ */
+#if GRID_CELLS < 256
+typedef uint8_t Cell;
+#else
+typedef uint16_t Cell;
+#endif
+
+#define CELL_NONE ((Cell)GRID_CELLS)
+#define CELL_OF(x, y) ((Cell)(((y) * GRID_WIDTH) + (x)))
+#define CELL_X(cell) ((cell) % GRID_WIDTH)
+#define CELL_Y(cell) ((cell) / GRID_WIDTH)
+
+// Set to 1 to store the body as a 2-bit direction per segment instead of one Cell per segment.
+// It is used on boards where a Cell takes two bytes, which cuts the body from 16 to 2 bits per segment.
+#ifndef SNAKE_DIRECTION_CHAIN
+#define SNAKE_DIRECTION_CHAIN (GRID_CELLS >= 256)
+#endif
+
+/**
+ * @brief The change of the cell index for one move in each Direction.
+ */
+extern const int16_t cell_delta[4];
 
-extern Coord food;
-extern Coord snake[MAX_SNAKE_LENGTH];
-extern uint8_t snake_length;
+/**
+ * @brief The cells of the head and the tail of the snake. The body between them is kept inside
+ * Game_Logic: as a ring buffer of Cells, or as a chain of directions from the tail to the head
+ * when SNAKE_DIRECTION_CHAIN is 1. Renderers only need the head, the tail, and the occupancy bitmap.
+ */
+extern Cell snake_head;
+extern Cell snake_tail;
+
+/**
+ * @brief One bit per cell, set when the snake or a wall of the level occupies the cell.
+ * The bit of a cell is bit (cell % 8) of byte (cell / 8). The walls are copied in from
+ * level_walls when the snake is placed, so one bit test finds both.
+ */
+extern uint8_t snake_occupancy[(GRID_CELLS + 7) / 8];
+
+extern Cell food;
+extern Cell last_tail;
+extern uint16_t snake_length;
 extern Direction current_direction;
 extern uint32_t game_score;
 
+// Period between two ticks in 1/256 us, set from the difficulty curve each time the snake eats
+extern uint32_t snake_period;
+
+// The same period rounded down to milliseconds, as shown on the HUD
+extern uint32_t snake_delay_ms;
+
+/**
+ * @brief The state of the random number generator used to place the food. It is part of the
+ * game state, so a saved game places the same food after it is resumed.
+ */
+extern uint32_t random_state;
+
+/**
+ * @brief When true, the snake wraps around the edges of the board instead of hitting them.
+ * The neighbors of a cell on a wrapped board are found without a branch: from a table with the
+ * four neighbors of each cell, or with masks when both sides of the board are powers of two.
+ * It is only changed between games.
+ */
+extern bool board_wrap;
+
 /**
  * @brief The Food_Init function initializes the placement of the food.
  * 
  * The coordinates of the food were determined by a random number, a modulo operator, 
- * and the grid's width/length.
+ * and the grid's width/length. The food is never placed on the snake: after a few random cells
+ * that are occupied, a random free cell is picked from the occupancy bitmap instead, so the time
+ * taken stays bounded when the board is almost full.
+ *
+ * The random cells must also pass the food rule of the level. The free cell picked from the
+ * bitmap does not, so the food is still placed when no free cell passes the rule.
  *
  * @param None
  *
@@ -55,6 +132,7 @@ void Food_Init(void);
 
 /**
  * @brief The Game_Init function initializes the game state, snake, food, and game score.
+ * It loads the walls of level_selected and places the snake at the spawn of the level.
  * 
  * The coordinates of the food were determined by a random number, a modulo operator, 
  * and the grid's width/length.
@@ -65,10 +143,106 @@ void Food_Init(void);
  */
 void Game_Init(void);
 
+/**
+ * @brief The Game_Init_Snake_At function initializes the game state like Game_Init, but places the
+ * head of the snake at the given cell, on the walls that are already loaded. The body is placed
+ * behind the head, and the snake moves in the given direction.
+ *
+ * @param x The column of the head.
+ * @param y The row of the head.
+ * @param direction The direction of the snake. The INITIAL_SNAKE_LENGTH - 1 cells behind the head
+ * must be free and on the board.
+ *
+ * @return None
+ */
+void Game_Init_Snake_At(uint8_t x, uint8_t y, Direction direction);
+
+/**
+ * @brief The Game_Won function checks if the snake fills every cell that is not a wall.
+ *
+ * @param None
+ *
+ * @return True if the game is won; false otherwise.
+ */
+bool Game_Won(void);
+
+/**
+ * @brief The Game_Random function returns the next number of a xorshift32 generator.
+ *
+ * @param None
+ *
+ * @return A pseudo-random 32-bit number.
+ */
+uint32_t Game_Random(void);
+
+/**
+ * @brief The Game_Step function runs the logic of one game tick: it moves the snake in
+ * current_direction, grows it and places new food if it reaches the food, and updates the speed.
+ *
+ * The result only depends on the game state and current_direction, so a saved game is resumed
+ * by calling it again with the saved directions.
+ *
+ * @param None
+ *
+ * @return True if the snake ate the food during this tick; false otherwise.
+ */
+bool Game_Step(void);
+
+/**
+ * @brief The Snake_Save_Body function stores the body as the 2-bit Direction of each move from
+ * the tail to the head (snake_length - 1 moves, four per byte, first move in the lowest bits).
+ *
+ * @param moves The buffer that receives the moves.
+ * @param size The size of the buffer in bytes.
+ *
+ * @return True if the moves fit in the buffer; false otherwise.
+ */
+bool Snake_Save_Body(uint8_t *moves, uint16_t size);
+
+/**
+ * @brief The Snake_Load_Body function rebuilds the snake and the occupancy bitmap from the moves
+ * stored by Snake_Save_Body, on the walls that are already loaded. snake_head is set to the end
+ * of the moves.
+ *
+ * @param tail The cell of the tail.
+ * @param length The length of the snake.
+ * @param moves The moves from the tail to the head.
+ *
+ * @return None
+ */
+void Snake_Load_Body(Cell tail, uint16_t length, const uint8_t *moves);
+
+/**
+ * @brief The Cell_Neighbor function finds the cell next to a cell, as the snake moves.
+ *
+ * @param cell The cell to move from. It must be on the board.
+ * @param direction The direction of the move.
+ *
+ * @return The next cell, wrapped around the edges when board_wrap is true, or CELL_NONE if
+ * the move leaves a board with walls.
+ */
+Cell Cell_Neighbor(Cell cell, Direction direction);
+
+/**
+ * @brief The Cell_Occupied function checks if the snake or a wall occupies a cell with one bit test.
+ *
+ * @param cell The cell to check. It must be on the board.
+ *
+ * @return True if the snake or a wall occupies the cell; false otherwise.
+ */
+bool Cell_Occupied(Cell cell);
+
 /**
  * @brief The Snake_Move function updates the snake's position and movement based on its
  * current direction.
  * 
+ * The cell vacated by the tail is saved in last_tail so that Snake_Grow can restore it
+ * and so that renderers can send only the cells that changed.
+ * The head and the tail each move by one cell_delta and the occupancy bitmap is updated for both,
+ * so a move takes the same time for any length. Collisions are detected here; when the head would
+ * leave the board, the snake is not moved. When board_wrap is true, a head that leaves the board
+ * enters it again on the other side.
+ * 
  * @param None
  *
  * @return None
@@ -78,6 +252,9 @@ void Snake_Move(void);
 /**
  * @brief The Snake_Grow function increments the snake's length and game score.
  * 
+ * The new tail segment is placed back on last_tail, so the tail does not vacate its cell
+ * on the tick that the snake eats.
+ * 
  * @param None
  *
  * @return None
@@ -87,6 +264,8 @@ void Snake_Grow(void);
 /**
  * @brief The Check_Collision function checks if the snake hits a wall or itself.
  * 
+ * The check is done by Snake_Move with the occupancy bitmap, so this function only returns its result.
+ * 
  * @param None
  *
  * @return False if a collision has NOT occurred; true if a collision has occurred.
@@ -0,0 +1,150 @@
+/**
+ * @file Game_Protocol.c
+ *
+ * @brief Source code for the Game_Protocol driver.
+ *
+ * This file contains the function definitions for the Game_Protocol driver.
+ * Each message is assembled in a buffer, a CRC-16 is appended, and the result is
+ * COBS-encoded and transmitted through UART0. The message layout is described in the
+ * header code of the Game_Protocol driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Game_Protocol.h"
+#include "Game_Logic.h"
+#include "Level_Pack.h"
+#include "UART0.h"
+#include "CRC16.h"
+#include "COBS.h"
+#include <string.h>
+
+// Type, sequence number, keyframe header (13 bytes), the walls, the occupancy bitmap, and the CRC
+#define PROTOCOL_MAX_MESSAGE (2 + 13 + LEVEL_MAX_WALLS_SIZE + sizeof(snake_occupancy) + 2)
+
+// The 0x00 delimiter is added after the encoded message
+#define PROTOCOL_MAX_ENCODED (COBS_MAX_ENCODED(PROTOCOL_MAX_MESSAGE) + 1)
+
+static uint8_t message[PROTOCOL_MAX_MESSAGE];
+static uint8_t encoded[PROTOCOL_MAX_ENCODED];
+static uint8_t sequence_number = 0;
+static uint8_t deltas_since_keyframe = 0;
+static Cell last_food;
+static uint32_t last_score;
+
+static void Protocol_Send_Message(uint16_t length)
+{
+	uint16_t crc = CRC16_Update(CRC16_INITIAL, message, length);
+	message[length++] = crc & 0xFF;
+	message[length++] = crc >> 8;
+
+	uint16_t encoded_length = COBS_Encode(message, length, encoded);
+	encoded[encoded_length++] = 0x00;
+
+	UART0_Output_Buffer((const char *)encoded, encoded_length);
+	sequence_number++;
+}
+
+static uint16_t Protocol_Begin_Message(uint8_t type)
+{
+	message[0] = type;
+	message[1] = sequence_number;
+	return 2;
+}
+
+void Protocol_Init(void)
+{
+	sequence_number = 0;
+	deltas_since_keyframe = 0;
+}
+
+void Protocol_Send_Keyframe(void)
+{
+	// The text printed before a keyframe does not end with a 0x00 byte, so one is sent first.
+	// Otherwise the text would be read as the start of the keyframe, which would fail its CRC.
+	UART0_Output_Character(0x00);
+
+	uint16_t length = Protocol_Begin_Message(PROTOCOL_MSG_KEYFRAME);
+	message[length++] = GRID_WIDTH;
+	message[length++] = GRID_HEIGHT;
+	message[length++] = game_score & 0xFF;
+	message[length++] = (game_score >> 8) & 0xFF;
+	message[length++] = current_direction;
+	message[length++] = CELL_X(food);
+	message[length++] = CELL_Y(food);
+	message[length++] = snake_length & 0xFF;
+	message[length++] = (snake_length >> 8) & 0xFF;
+	message[length++] = CELL_X(snake_head);
+	message[length++] = CELL_Y(snake_head);
+
+	// The walls are sent in the compressed form of Level_Pack, which is much smaller than a bitmap
+	const Level *level = &levels[level_loaded];
+	message[length++] = level_loaded;
+	message[length++] = level->walls_size;
+	memcpy(&message[length], level->walls, level->walls_size);
+	length += level->walls_size;
+
+	// The body is sent as the occupancy bitmap, which is smaller than a list of segments.
+	// The walls are taken out, since the bitmap only holds the snake in the protocol.
+	for (uint16_t i = 0; i < sizeof(snake_occupancy); i++)
+	{
+		message[length++] = snake_occupancy[i] & ~level_walls[i];
+	}
+	Protocol_Send_Message(length);
+
+	last_food = food;
+	last_score = game_score;
+	deltas_since_keyframe = 0;
+}
+
+void Protocol_Send_Delta(bool snake_grew)
+{
+	if (deltas_since_keyframe >= PROTOCOL_KEYFRAME_INTERVAL)
+	{
+		Protocol_Send_Keyframe();
+		return;
+	}
+
+	uint16_t length = Protocol_Begin_Message(PROTOCOL_MSG_DELTA);
+	uint16_t flags_index = length++;
+	uint8_t flags = 0;
+
+	message[length++] = CELL_X(snake_head);
+	message[length++] = CELL_Y(snake_head);
+
+	// The tail keeps its cell on the tick that the snake grows
+	if (!snake_grew)
+	{
+		flags |= PROTOCOL_DELTA_TAIL_VACATED;
+		message[length++] = CELL_X(last_tail);
+		message[length++] = CELL_Y(last_tail);
+	}
+
+	if (food != last_food)
+	{
+		flags |= PROTOCOL_DELTA_FOOD_MOVED;
+		message[length++] = CELL_X(food);
+		message[length++] = CELL_Y(food);
+		last_food = food;
+	}
+
+	if (game_score != last_score)
+	{
+		flags |= PROTOCOL_DELTA_SCORE_CHANGED;
+		message[length++] = game_score & 0xFF;
+		message[length++] = (game_score >> 8) & 0xFF;
+		last_score = game_score;
+	}
+
+	message[flags_index] = flags;
+	Protocol_Send_Message(length);
+	deltas_since_keyframe++;
+}
+
+void Protocol_Send_Game_Over(void)
+{
+	uint16_t length = Protocol_Begin_Message(PROTOCOL_MSG_GAME_OVER);
+	message[length++] = game_score & 0xFF;
+	message[length++] = (game_score >> 8) & 0xFF;
+	Protocol_Send_Message(length);
+}
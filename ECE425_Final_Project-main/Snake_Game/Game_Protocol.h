@@ -0,0 +1,95 @@
+/**
+ * @file Game_Protocol.h
+ *
+ * @brief Header code for the Game_Protocol driver.
+ *
+ * This file contains the function definitions for the Game_Protocol driver.
+ * The Game_Protocol driver is an alternate output mode that sends the game state as
+ * small binary messages instead of ANSI text, so a host-side program can render the board.
+ *
+ * Every message is built as follows, then COBS-encoded and terminated by a 0x00 byte:
+ *
+ *  Byte(s)     Field
+ *  0           Message type (PROTOCOL_MSG_KEYFRAME, PROTOCOL_MSG_DELTA, PROTOCOL_MSG_GAME_OVER)
+ *  1           Sequence number (increments by one per message and wraps at 255)
+ *  2 to n-3    Payload (see the functions below)
+ *  n-2, n-1    CRC-16/CCITT-FALSE of bytes 0 to n-3, low byte first
+ *
+ * Since COBS removes every 0x00 from the encoded message, a host can resynchronize at any
+ * 0x00 byte. Any text that the firmware prints between messages fails the CRC and is dropped.
+ * A keyframe is sent after an extra 0x00 byte, so the text before it is not read as part of it.
+ *
+ * The snake_client program in Host_Tools decodes the messages and draws the board on the host.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef game_protocol_header
+#define game_protocol_header
+#include <stdint.h>
+#include <stdbool.h>
+
+#define PROTOCOL_MSG_KEYFRAME   0x01
+#define PROTOCOL_MSG_DELTA      0x02
+#define PROTOCOL_MSG_GAME_OVER  0x03
+
+// Flags used in the first payload byte of a PROTOCOL_MSG_DELTA message
+#define PROTOCOL_DELTA_TAIL_VACATED   0x01
+#define PROTOCOL_DELTA_FOOD_MOVED     0x02
+#define PROTOCOL_DELTA_SCORE_CHANGED  0x04
+
+// A keyframe is sent after this many deltas so that a host can recover from a lost message
+#define PROTOCOL_KEYFRAME_INTERVAL 64
+
+/**
+ * @brief The Protocol_Init function resets the sequence number and the keyframe counter.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Protocol_Init(void);
+
+/**
+ * @brief The Protocol_Send_Keyframe function sends the full game state.
+ *
+ * Payload: grid width, grid height, score (2 bytes), direction, food x, food y,
+ * snake length (2 bytes), head x, head y, level number, size n of the walls, the n bytes of the
+ * walls in the compressed form of Level_Pack (see Level_Pack.h), followed by the snake_occupancy
+ * bitmap without the walls (one bit per cell, row by row, least significant bit first).
+ * When the snake fills the board, the food y is GRID_HEIGHT.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Protocol_Send_Keyframe(void);
+
+/**
+ * @brief The Protocol_Send_Delta function sends only the cells that changed during one tick.
+ *
+ * Payload: flags, head x, head y, then tail x and tail y if the tail vacated its cell,
+ * food x and food y if the food moved, and the score if it changed.
+ * A keyframe is sent instead every PROTOCOL_KEYFRAME_INTERVAL ticks.
+ *
+ * A decoder must clear the vacated tail cell before it sets the head cell. When the snake follows
+ * its tail, the head moves into last_tail on the same tick, and the cell would be left empty if
+ * the head were set first.
+ *
+ * @param snake_grew True if the snake ate the food during this tick.
+ *
+ * @return None
+ */
+void Protocol_Send_Delta(bool snake_grew);
+
+/**
+ * @brief The Protocol_Send_Game_Over function sends the final score.
+ *
+ * Payload: score.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Protocol_Send_Game_Over(void);
+#endif
@@ -3,41 +3,55 @@
  *
  * @brief Source code for the Game_Replay driver.
  *
- * The boolean function Play_Again prompts the user to play the snake game again.
- * It then checks the user's input with possible 3 cases: Y/y, N/n, or other keys.
+ * The Play_Again_Prompt function prompts the user to play the snake game again, and the
+ * Play_Again_Key function checks each key of the reply with possible 5 cases: Y/y, N/n, T/t, E/e,
+ * or other keys.
+ * T/t prints the timing of the last game ticks as a VCD file before prompting again, and
+ * E/e sends the events that led to the game over in the binary form of the Event_Trace driver.
  *
  * @author Samira Cordero-Morales
 */
 
 #include "UART0.h"
 #include "Game_Replay.h"
+#include "Phase_Trace.h"
+#include "Event_Trace.h"
 
-bool Play_Again(void)
+void Play_Again_Prompt(void)
 {
-	char reply = 0;
 	UART0_Output_Newline();
-	UART0_Output_String("Would you like to play again? (Y/N): ");
+	UART0_Output_String("Would you like to play again? (Y/N, T for a timing trace, or E for the event trace): ");
+}
+
+Play_Again_Reply Play_Again_Key(char reply)
+{
+	UART0_Output_Character(reply);
 	
-	while(1)
+	if (reply == 'Y' || reply == 'y')
+	{
+		return PLAY_AGAIN_YES;
+	}
+	else if (reply == 'N' || reply == 'n')
+	{
+		return PLAY_AGAIN_NO;
+	}
+	else if (reply == 'T' || reply == 't')
+	{
+		UART0_Output_Newline();
+		Phase_Trace_Dump_VCD();
+		UART0_Output_String("Press Y or N: ");
+	}
+	else if (reply == 'E' || reply == 'e')
+	{
+		UART0_Output_Newline();
+		Event_Trace_Dump();
+		UART0_Output_Newline();
+		UART0_Output_String("Press Y or N: ");
+	}
+	else
 	{
-		if (UART0_Char_Available())
-		{
-			reply = UART0_Input_Character();
-			UART0_Output_Character(reply);
-			
-			if (reply == 'Y' || reply == 'y')
-			{
-				return true;
-			}
-			else if (reply == 'N' || reply == 'n')
-			{
-				return false;
-			}
-			else
-			{
-				UART0_Output_Newline();
-				UART0_Output_String("Invalid input. Press Y or N: ");
-			}
-		}
+		UART0_Output_Newline();
+		UART0_Output_String("Invalid input. Press Y or N: ");
 	}
-}
\ No newline at end of file
+	return PLAY_AGAIN_WAITING;
+}
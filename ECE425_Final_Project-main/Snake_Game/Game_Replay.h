@@ -3,7 +3,7 @@
  *
  * @brief Header code for the Game_Replay driver.
  *
- * Adds the protoype of the Play_Again function.
+ * Adds the protoypes of the Play_Again_Prompt and Play_Again_Key functions.
  * The #ifndef & #define preprocessor directives helps avoid complier errors due
  * to other files containing Game_Replay.h.
  *
@@ -14,15 +14,35 @@
 #define game_replay_header
 #include <stdbool.h>
 
+typedef enum
+{
+	PLAY_AGAIN_WAITING,
+	PLAY_AGAIN_YES,
+	PLAY_AGAIN_NO
+} Play_Again_Reply;
+
+/**
+ * @brief The Play_Again_Prompt function displays a prompt asking if the user wants to play again.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Play_Again_Prompt(void);
+
 /**
- * @brief The Play_Again function displays a prompt asking if the user wants to play again
- * and checks the user's response.
+ * @brief The Play_Again_Key function echoes one key of the user's response and checks it.
+ * It returns right away, so the caller keeps running while it waits for the next key.
  * 
+ * If the user enters "T/t", the tick timing captured by the Phase_Trace driver is printed as a
+ * VCD file, and if the user enters "E/e", the events recorded by the Event_Trace driver are sent.
+ * In both cases, the function prompts the user again.
  * If the user enters an invalid input, the function prompts the user again.
  * 
- * @param None
+ * @param reply The key received from the user.
  *
- * @return False if the user entered "N/n"; true if the user entered "Y/y".
+ * @return PLAY_AGAIN_NO if the user entered "N/n", PLAY_AGAIN_YES if the user entered "Y/y",
+ * and PLAY_AGAIN_WAITING otherwise.
  */
-bool Play_Again(void);
+Play_Again_Reply Play_Again_Key(char reply);
 #endif
\ No newline at end of file
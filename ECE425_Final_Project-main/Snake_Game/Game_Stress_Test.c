@@ -0,0 +1,124 @@
+/**
+ * @file Game_Stress_Test.c
+ *
+ * @brief Source code for the Game_Stress_Test driver.
+ *
+ * This file contains the function definitions for the Game_Stress_Test driver.
+ * More information about the path followed by the snake is on the header code of the
+ * Game_Stress_Test driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Game_Stress_Test.h"
+#include "Game_Logic.h"
+#include "Level_Pack.h"
+#include "Profiler.h"
+#include "UART0.h"
+
+#if (GRID_HEIGHT % 2) != 0
+#error "The Hamiltonian cycle of the stress test needs an even GRID_HEIGHT"
+#endif
+
+Direction Game_Stress_Test_Direction(Cell head)
+{
+	uint8_t x = CELL_X(head);
+	uint8_t y = CELL_Y(head);
+	
+	// Row 0 is followed to the right, then the cycle turns down the last column
+	if (y == 0)
+	{
+		return (x < GRID_WIDTH - 1) ? RIGHT : DOWN;
+	}
+	
+	// Column 0 leads back up to row 0
+	if (x == 0)
+	{
+		return UP;
+	}
+	
+	// Odd rows are followed to the left until column 1, and even rows to the right
+	if (y % 2 == 1)
+	{
+		if (x > 1)
+		{
+			return LEFT;
+		}
+		return (y == GRID_HEIGHT - 1) ? LEFT : DOWN;
+	}
+	return (x < GRID_WIDTH - 1) ? RIGHT : DOWN;
+}
+
+bool Game_Stress_Test(void)
+{
+	uint32_t ticks = 0;
+	uint64_t total_cycles = 0;
+	uint32_t min_cycles = 0xFFFFFFFF;
+	uint32_t max_cycles = 0;
+	uint32_t max_cycles_length = 0;
+	bool collision = false;
+	
+	UART0_Output_String("Running the full-board stress test");
+	
+	// The cycle covers every cell, so it needs the level without walls.
+	// The snake starts on row 0, which is part of the cycle, moving to the right.
+	Level_Load(LEVEL_OPEN);
+	Game_Init_Snake_At(INITIAL_SNAKE_LENGTH - 1, 0, RIGHT);
+	
+	while (snake_length < GRID_CELLS && snake_length < MAX_SNAKE_LENGTH)
+	{
+		current_direction = Game_Stress_Test_Direction(snake_head);
+		
+		uint32_t start_cycles = PROFILER_CYCLES();
+		Snake_Move();
+		if (snake_head == food)
+		{
+			Snake_Grow();
+			Food_Init();
+		}
+		collision = Check_Collision();
+		uint32_t cycles = PROFILER_CYCLES() - start_cycles;
+		
+		ticks++;
+		total_cycles += cycles;
+		if (cycles < min_cycles)
+		{
+			min_cycles = cycles;
+		}
+		if (cycles > max_cycles)
+		{
+			max_cycles = cycles;
+			max_cycles_length = snake_length;
+		}
+		
+		if (collision)
+		{
+			break;
+		}
+		
+		// Show progress every 65536 ticks
+		if ((ticks & 0xFFFF) == 0)
+		{
+			UART0_Output_Character('.');
+		}
+	}
+	
+	UART0_Output_Newline();
+	UART0_Output_String(collision ? "Collision after " : "Finished after ");
+	UART0_Output_Unsigned_Decimal(ticks);
+	UART0_Output_String(" ticks, snake length ");
+	UART0_Output_Unsigned_Decimal(snake_length);
+	UART0_Output_Newline();
+	UART0_Output_String("Logic cycles per tick: minimum ");
+	UART0_Output_Unsigned_Decimal(min_cycles);
+	UART0_Output_String(", average ");
+	UART0_Output_Unsigned_Decimal((uint32_t)(total_cycles / ticks));
+	UART0_Output_String(", maximum ");
+	UART0_Output_Unsigned_Decimal(max_cycles);
+	UART0_Output_String(" (at length ");
+	UART0_Output_Unsigned_Decimal(max_cycles_length);
+	UART0_Output_String(")");
+	UART0_Output_Newline();
+	
+	return !collision;
+}
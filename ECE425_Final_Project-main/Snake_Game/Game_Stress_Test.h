@@ -0,0 +1,47 @@
+/**
+ * @file Game_Stress_Test.h
+ *
+ * @brief Header code for the Game_Stress_Test driver.
+ *
+ * This file contains the function definitions for the Game_Stress_Test driver.
+ * The stress test plays a whole game without a player until the snake fills every cell of the
+ * board, and measures how long the game logic takes on each tick.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef game_stress_test_header
+#define game_stress_test_header
+#include "Game_Logic.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief The Game_Stress_Test function runs a full-board game and prints the tick timing.
+ *
+ * The snake follows a Hamiltonian cycle (a path that visits every cell once and returns to the
+ * start): right along row 0, back and forth through columns 1 to GRID_WIDTH - 1 of the other rows,
+ * and up column 0. Following the cycle never causes a collision, so the snake keeps eating until
+ * it fills the board. GRID_HEIGHT must be even for the cycle to close.
+ *
+ * The time of each tick's Snake_Move, Snake_Grow, Food_Init, and Check_Collision calls is
+ * measured with the DWT cycle counter. The minimum, average, and maximum are printed at the end
+ * so it can be confirmed that the tick time does not grow with the length of the snake.
+ * Nothing is drawn during the test.
+ *
+ * @param None
+ *
+ * @return True if the snake filled the board without a collision; false otherwise.
+ */
+bool Game_Stress_Test(void);
+
+/**
+ * @brief The Game_Stress_Test_Direction function returns the direction that follows the
+ * Hamiltonian cycle of the stress test from a cell.
+ *
+ * @param head The cell of the head of the snake.
+ *
+ * @return The direction of the next move on the cycle.
+ */
+Direction Game_Stress_Test_Direction(Cell head);
+#endif
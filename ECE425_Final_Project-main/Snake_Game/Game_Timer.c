@@ -0,0 +1,203 @@
+/**
+ * @file Game_Timer.c
+ *
+ * @brief Source code for the Game_Timer driver.
+ *
+ * This file contains the function definitions for the Game_Timer driver.
+ * TIMER0A_Handler is the only writer of ticks_signaled and Game_Timer_Take_Tick is the only
+ * writer of ticks_taken, so the tick count is shared without disabling interrupts.
+ *
+ * @note For more information regarding the timer module, refer to the
+ * General-Purpose Timers section of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @note Assumes that the frequency of the system clock is 50 MHz.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Game_Timer.h"
+#include "Profiler.h"
+#include "UART0.h"
+
+// Upper edge of each jitter bin in microseconds; the last bin has no upper edge
+static const uint16_t jitter_bin_edges_us[GAME_TIMER_JITTER_BINS - 1] = {1, 2, 5, 10, 20, 50, 100, 200, 500};
+
+static volatile uint32_t ticks_signaled = 0;
+static uint32_t ticks_taken = 0;
+
+// Period of the tick that is counting, and of the one that starts at the next time-out
+static volatile uint32_t counting_period_cycles = 0;
+static uint32_t next_period_cycles = 0;
+
+// Period of the interval that ended with the last tick that was signaled
+static volatile uint32_t signaled_period_cycles = 0;
+
+static uint32_t last_tick_cycles = 0;
+static bool last_tick_valid = false;
+
+static uint32_t jitter_histogram[GAME_TIMER_JITTER_BINS];
+static uint32_t max_jitter_cycles = 0;
+static uint32_t missed_ticks = 0;
+
+void Game_Timer_Init(void)
+{
+	// Enable the clock to Timer 0 by setting the R0 bit (Bit 0) in the RCGCTIMER register
+	SYSCTL->RCGCTIMER |= 0x01;
+	
+	// Wait until Timer 0 is ready by checking the R0 bit (Bit 0) in the PRTIMER register
+	while ((SYSCTL->PRTIMER & 0x01) == 0);
+	
+	// Disable Timer A before the configuration by clearing the TAEN bit (Bit 0)
+	TIMER0->CTL &= ~0x01;
+	
+	// Use the 32-bit timer configuration
+	TIMER0->CFG = 0x00000000;
+	
+	// Periodic mode (TAMR, Bits 1 to 0) counting down, with a new period loaded at the next
+	// time-out by setting the TAILD bit (Bit 8)
+	TIMER0->TAMR = 0x00000102;
+	
+	// Enable the time-out interrupt by setting the TATOIM bit (Bit 0)
+	TIMER0->ICR = 0x01;
+	TIMER0->IMR |= 0x01;
+	
+	NVIC_SetPriority(TIMER0A_IRQn, GAME_TIMER_INTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(TIMER0A_IRQn);
+}
+
+void Game_Timer_Start(uint32_t period_cycles)
+{
+	TIMER0->CTL &= ~0x01;
+	
+	next_period_cycles = period_cycles;
+	counting_period_cycles = next_period_cycles;
+	signaled_period_cycles = next_period_cycles;
+	TIMER0->TAILR = next_period_cycles - 1;
+	
+	// Loading the interval register does not reload the counter while TAILD is set
+	TIMER0->TAV = next_period_cycles - 1;
+	
+	for (int i = 0; i < GAME_TIMER_JITTER_BINS; i++)
+	{
+		jitter_histogram[i] = 0;
+	}
+	max_jitter_cycles = 0;
+	missed_ticks = 0;
+	last_tick_valid = false;
+	
+	// The first tick is due right away
+	ticks_taken = ticks_signaled - 1;
+	
+	TIMER0->ICR = 0x01;
+	TIMER0->CTL |= 0x01;
+}
+
+void Game_Timer_Stop(void)
+{
+	TIMER0->CTL &= ~0x01;
+	ticks_taken = ticks_signaled;
+}
+
+void Game_Timer_Set_Period(uint32_t period_cycles)
+{
+	if (period_cycles != next_period_cycles)
+	{
+		next_period_cycles = period_cycles;
+		TIMER0->TAILR = period_cycles - 1;
+	}
+}
+
+bool Game_Timer_Take_Tick(void)
+{
+	uint32_t signaled = ticks_signaled;
+	if (signaled == ticks_taken)
+	{
+		return false;
+	}
+	
+	uint32_t now = PROFILER_CYCLES();
+	uint32_t pending = signaled - ticks_taken;
+	ticks_taken = signaled;
+	
+	// An interval that spans a missed tick is not a measure of the jitter
+	if (pending > 1)
+	{
+		missed_ticks += pending - 1;
+	}
+	else if (last_tick_valid)
+	{
+		uint32_t interval = now - last_tick_cycles;
+		uint32_t period = signaled_period_cycles;
+		uint32_t jitter = (interval > period) ? interval - period : period - interval;
+		uint32_t jitter_us = jitter / PROFILER_CYCLES_PER_US;
+		
+		uint8_t bin = 0;
+		while (bin < GAME_TIMER_JITTER_BINS - 1 && jitter_us >= jitter_bin_edges_us[bin])
+		{
+			bin++;
+		}
+		jitter_histogram[bin]++;
+		
+		if (jitter > max_jitter_cycles)
+		{
+			max_jitter_cycles = jitter;
+		}
+	}
+	last_tick_cycles = now;
+	last_tick_valid = true;
+	return true;
+}
+
+bool Game_Timer_Tick_Pending(void)
+{
+	return ticks_signaled != ticks_taken;
+}
+
+void Game_Timer_Report_Jitter(void)
+{
+	UART0_Output_String("Tick jitter (us):");
+	for (int i = 0; i < GAME_TIMER_JITTER_BINS; i++)
+	{
+		UART0_Output_Character(' ');
+		if (i == 0)
+		{
+			UART0_Output_Character('<');
+		}
+		else
+		{
+			UART0_Output_Unsigned_Decimal(jitter_bin_edges_us[i - 1]);
+		}
+		if (i == GAME_TIMER_JITTER_BINS - 1)
+		{
+			UART0_Output_Character('+');
+		}
+		else
+		{
+			if (i != 0)
+			{
+				UART0_Output_Character('-');
+			}
+			UART0_Output_Unsigned_Decimal(jitter_bin_edges_us[i]);
+		}
+		UART0_Output_Character(':');
+		UART0_Output_Unsigned_Decimal(jitter_histogram[i]);
+	}
+	UART0_Output_Newline();
+	UART0_Output_String("Largest tick jitter: ");
+	UART0_Output_Unsigned_Decimal(Profiler_Cycles_To_us(max_jitter_cycles));
+	UART0_Output_String(" us, missed ticks: ");
+	UART0_Output_Unsigned_Decimal(missed_ticks);
+	UART0_Output_Newline();
+}
+
+void TIMER0A_Handler(void)
+{
+	// Clear the time-out flag by setting the TATOCINT bit (Bit 0) in the GPTMICR register
+	TIMER0->ICR = 0x01;
+	
+	// The interval that just ended used the period that was counting; the next one starts now
+	signaled_period_cycles = counting_period_cycles;
+	counting_period_cycles = TIMER0->TAILR + 1;
+	ticks_signaled = ticks_signaled + 1;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file Game_Timer.h
+ *
+ * @brief Header code for the Game_Timer driver.
+ *
+ * This file contains the function definitions for the Game_Timer driver.
+ * It uses Timer 0A of the General-Purpose Timer Module (GPTM) as a 32-bit periodic timer that
+ * signals each game tick to the main loop. The period is set in clock cycles (20 ns), and the timer
+ * keeps counting while a tick is processed, so the tick rate does not depend on the time taken
+ * by the render.
+ *
+ * A new period is loaded at the next time-out (the TAILD bit in GPTMTAMR), so the tick that is
+ * already counting is never cut short or stretched.
+ *
+ * Each tick that the main loop takes is compared with the previous one, and the difference
+ * between the measured interval and the period is recorded in a jitter histogram.
+ *
+ * @note For more information regarding the timer module, refer to the
+ * General-Purpose Timers section of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @note Assumes that the frequency of the system clock is 50 MHz.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef game_timer_header
+#define game_timer_header
+#include "TM4C123GH6PM.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+// Above the input interrupts, so that the time of each tick is not delayed by a key
+#define GAME_TIMER_INTERRUPT_PRIORITY 2
+
+// Number of bins of the jitter histogram (see Game_Timer_Report_Jitter)
+#define GAME_TIMER_JITTER_BINS 10
+
+/**
+ * @brief The Game_Timer_Init function configures Timer 0A as a periodic timer with its
+ * time-out interrupt, but does not start it.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Game_Timer_Init(void);
+
+/**
+ * @brief The Game_Timer_Start function starts the timer with the given period and clears the
+ * jitter histogram. The first tick is signaled right away.
+ *
+ * @param period_cycles The tick period in system clock cycles.
+ *
+ * @return None
+ */
+void Game_Timer_Start(uint32_t period_cycles);
+
+/**
+ * @brief The Game_Timer_Stop function stops the timer and drops the ticks that were not taken.
+ * The jitter histogram is kept, so it can be reported after the game.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Game_Timer_Stop(void);
+
+/**
+ * @brief The Game_Timer_Set_Period function changes the tick period. The new period starts at
+ * the next time-out. Nothing is written if the period did not change.
+ *
+ * @param period_cycles The tick period in system clock cycles.
+ *
+ * @return None
+ */
+void Game_Timer_Set_Period(uint32_t period_cycles);
+
+/**
+ * @brief The Game_Timer_Take_Tick function checks if a tick was signaled since the last call.
+ *
+ * If the main loop fell behind by more than one tick, the missed ticks are counted and dropped,
+ * so the game does not run several ticks in a row to catch up.
+ *
+ * @param None
+ *
+ * @return True if a tick is due; false otherwise.
+ */
+bool Game_Timer_Take_Tick(void);
+
+/**
+ * @brief The Game_Timer_Tick_Pending function checks if a tick was signaled and not taken yet,
+ * without taking it.
+ *
+ * @param None
+ *
+ * @return True if Game_Timer_Take_Tick would return true; false otherwise.
+ */
+bool Game_Timer_Tick_Pending(void);
+
+/**
+ * @brief The Game_Timer_Report_Jitter function prints the jitter histogram, the largest jitter,
+ * and the number of missed ticks to the serial terminal.
+ *
+ * The bins are: under 1 us, 1 - 2 us, 2 - 5 us, 5 - 10 us, 10 - 20 us, 20 - 50 us,
+ * 50 - 100 us, 100 - 200 us, 200 - 500 us, and 500 us or more.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Game_Timer_Report_Jitter(void);
+
+/**
+ * @brief The TIMER0A_Handler function is the interrupt service routine of the Timer 0A time-out.
+ * It signals one tick to the main loop.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void TIMER0A_Handler(void);
+#endif
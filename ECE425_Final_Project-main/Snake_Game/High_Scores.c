@@ -0,0 +1,207 @@
+/**
+ * @file High_Scores.c
+ *
+ * @brief Source code for the High_Scores driver.
+ *
+ * This file contains the function definitions for the High_Scores driver.
+ * More information about the record format and the wear leveling is on the header code of the
+ * High_Scores driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "High_Scores.h"
+#include "EEPROM.h"
+#include "CRC16.h"
+#include "UART0.h"
+
+#define HIGH_SCORES_RECORD_WORDS (HIGH_SCORES_COUNT + 3)
+#define HIGH_SCORES_CRC_WORD (HIGH_SCORES_RECORD_WORDS - 1)
+
+typedef enum
+{
+	HIGH_SCORES_STARTING,
+	HIGH_SCORES_LOADING,
+	HIGH_SCORES_IDLE,
+	HIGH_SCORES_SAVING,
+	HIGH_SCORES_UNAVAILABLE
+} High_Scores_State;
+
+uint32_t high_scores[HIGH_SCORES_COUNT];
+
+static High_Scores_State state = HIGH_SCORES_UNAVAILABLE;
+
+// The record being loaded or saved
+static uint32_t record[HIGH_SCORES_RECORD_WORDS];
+
+// Block checked by the next load step, or word written by the next save step
+static uint8_t step_index;
+
+// Block and sequence number of the newest valid record
+static bool record_found;
+static uint8_t newest_block;
+static uint32_t newest_sequence;
+
+static uint16_t High_Scores_Record_CRC(void)
+{
+	return CRC16_Update(CRC16_INITIAL, (const uint8_t *)record, HIGH_SCORES_CRC_WORD * sizeof(uint32_t));
+}
+
+static void High_Scores_Load_Block(uint8_t block)
+{
+	for (int i = 0; i < HIGH_SCORES_RECORD_WORDS; i++)
+	{
+		record[i] = EEPROM_Read_Word(HIGH_SCORES_FIRST_BLOCK + block, i);
+	}
+
+	if (record[0] != HIGH_SCORES_TAG || record[HIGH_SCORES_CRC_WORD] != High_Scores_Record_CRC())
+	{
+		return;
+	}
+
+	// The sequence number wraps around, so the newer record is the one that is ahead by less than half
+	if (!record_found || (int32_t)(record[1] - newest_sequence) > 0)
+	{
+		record_found = true;
+		newest_block = block;
+		newest_sequence = record[1];
+		for (int i = 0; i < HIGH_SCORES_COUNT; i++)
+		{
+			high_scores[i] = record[2 + i];
+		}
+	}
+}
+
+void High_Scores_Init(void)
+{
+	for (int i = 0; i < HIGH_SCORES_COUNT; i++)
+	{
+		high_scores[i] = 0;
+	}
+	record_found = false;
+	newest_block = HIGH_SCORES_BLOCK_COUNT - 1;
+	newest_sequence = 0;
+
+	EEPROM_Init();
+	state = HIGH_SCORES_STARTING;
+}
+
+void High_Scores_Poll(void)
+{
+	if (state == HIGH_SCORES_IDLE || state == HIGH_SCORES_UNAVAILABLE || EEPROM_Busy())
+	{
+		return;
+	}
+
+	switch (state)
+	{
+		case HIGH_SCORES_STARTING:
+		{
+			// The EEPROM has finished recovering from the last reset; the table is kept in RAM only if it failed
+			state = EEPROM_Error() ? HIGH_SCORES_UNAVAILABLE : HIGH_SCORES_LOADING;
+			step_index = 0;
+			break;
+		}
+		case HIGH_SCORES_LOADING:
+		{
+			High_Scores_Load_Block(step_index);
+			step_index++;
+			if (step_index == HIGH_SCORES_BLOCK_COUNT)
+			{
+				state = HIGH_SCORES_IDLE;
+			}
+			break;
+		}
+		case HIGH_SCORES_SAVING:
+		{
+			EEPROM_Write_Word(HIGH_SCORES_FIRST_BLOCK + newest_block, step_index, record[step_index]);
+			step_index++;
+			if (step_index == HIGH_SCORES_RECORD_WORDS)
+			{
+				state = HIGH_SCORES_IDLE;
+			}
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+}
+
+bool High_Scores_Busy(void)
+{
+	return state != HIGH_SCORES_IDLE && state != HIGH_SCORES_UNAVAILABLE;
+}
+
+uint8_t High_Scores_Submit(uint32_t score)
+{
+	// The load only reads a few words, so it can be finished here without a long wait
+	while (state == HIGH_SCORES_STARTING || state == HIGH_SCORES_LOADING)
+	{
+		High_Scores_Poll();
+	}
+
+	// A save that has not finished is started again with the new table
+	if (state == HIGH_SCORES_SAVING)
+	{
+		while (EEPROM_Busy());
+	}
+
+	uint8_t rank = HIGH_SCORES_COUNT;
+	while (rank > 0 && score > high_scores[rank - 1])
+	{
+		rank--;
+	}
+
+	if (rank == HIGH_SCORES_COUNT)
+	{
+		return 0;
+	}
+
+	for (int i = HIGH_SCORES_COUNT - 1; i > rank; i--)
+	{
+		high_scores[i] = high_scores[i - 1];
+	}
+	high_scores[rank] = score;
+
+	if (state != HIGH_SCORES_UNAVAILABLE)
+	{
+		// The new record goes to the block after the newest one, so the newest record stays valid
+		// until the new one is complete
+		if (state != HIGH_SCORES_SAVING)
+		{
+			newest_block = (newest_block + 1) % HIGH_SCORES_BLOCK_COUNT;
+			newest_sequence++;
+		}
+
+		record[0] = HIGH_SCORES_TAG;
+		record[1] = newest_sequence;
+		for (int i = 0; i < HIGH_SCORES_COUNT; i++)
+		{
+			record[2 + i] = high_scores[i];
+		}
+		record[HIGH_SCORES_CRC_WORD] = High_Scores_Record_CRC();
+
+		step_index = 0;
+		state = HIGH_SCORES_SAVING;
+	}
+	return rank + 1;
+}
+
+void High_Scores_Print(uint8_t new_rank)
+{
+	UART0_Output_String("High scores:");
+	for (int i = 0; i < HIGH_SCORES_COUNT; i++)
+	{
+		UART0_Output_String("  ");
+		UART0_Output_Unsigned_Decimal(i + 1);
+		UART0_Output_String(". ");
+		UART0_Output_Unsigned_Decimal(high_scores[i]);
+		if (new_rank == i + 1)
+		{
+			UART0_Output_String(" (new)");
+		}
+	}
+	UART0_Output_Newline();
+}
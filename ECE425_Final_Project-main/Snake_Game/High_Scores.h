@@ -0,0 +1,102 @@
+/**
+ * @file High_Scores.h
+ *
+ * @brief Header code for the High_Scores driver.
+ *
+ * This file contains the function definitions for the High_Scores driver.
+ * The High_Scores driver keeps the best HIGH_SCORES_COUNT scores in the on-chip EEPROM, so they
+ * are kept when the board is reset or powered off.
+ *
+ * Each save writes the whole table as one record to the next of HIGH_SCORES_BLOCK_COUNT EEPROM
+ * blocks, so every block is programmed once every HIGH_SCORES_BLOCK_COUNT saves (wear leveling).
+ * A record is made of the following words:
+ *
+ *  Word(s)     Field
+ *  0           HIGH_SCORES_TAG (format version and board size)
+ *  1           Sequence number (increments by one per save)
+ *  2 to 6      Scores, highest first
+ *  7           CRC-16/CCITT-FALSE of words 0 to 6 in the lower half
+ *
+ * The CRC is written last, so a record that was torn by a reset during a save fails the CRC.
+ * At startup, the valid record with the highest sequence number is loaded, which is the last
+ * complete save.
+ *
+ * Nothing is read or written while a game is running. High_Scores_Poll does one step of the
+ * load or the save per call, and the main loop calls it in every state except the game.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef high_scores_header
+#define high_scores_header
+#include "Game_Logic.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HIGH_SCORES_COUNT 5
+
+// EEPROM blocks used by the table; the other blocks are free for other drivers
+#define HIGH_SCORES_FIRST_BLOCK 0
+#define HIGH_SCORES_BLOCK_COUNT 8
+
+#define HIGH_SCORES_VERSION 1
+#define HIGH_SCORES_TAG (0x48530000 | (HIGH_SCORES_VERSION << 8) | LARGE_BOARD)
+
+/**
+ * @brief The table of high scores, highest first. Empty entries are 0.
+ */
+extern uint32_t high_scores[HIGH_SCORES_COUNT];
+
+/**
+ * @brief The High_Scores_Init function enables the EEPROM and starts loading the table.
+ *
+ * It returns without waiting; the table is loaded by the following calls to High_Scores_Poll.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void High_Scores_Init(void);
+
+/**
+ * @brief The High_Scores_Poll function does one step of the load or the save, if the EEPROM
+ * is not busy. Each step reads one record or writes one word.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void High_Scores_Poll(void);
+
+/**
+ * @brief The High_Scores_Busy function checks if a load or a save is in progress, so that
+ * High_Scores_Poll still has steps to do.
+ *
+ * @param None
+ *
+ * @return True while the table is being loaded or saved; false otherwise.
+ */
+bool High_Scores_Busy(void);
+
+/**
+ * @brief The High_Scores_Submit function adds a score to the table and schedules a save.
+ *
+ * If the table is still being loaded, the load is finished first. The save itself is done by
+ * the following calls to High_Scores_Poll.
+ *
+ * @param score The final score of a game.
+ *
+ * @return The rank of the score (1 for the highest), or 0 if it is not in the table.
+ */
+uint8_t High_Scores_Submit(uint32_t score);
+
+/**
+ * @brief The High_Scores_Print function prints the table on one line, with a mark next to the
+ * entry at a given rank.
+ *
+ * @param new_rank The rank returned by High_Scores_Submit, or 0 for no mark.
+ *
+ * @return None
+ */
+void High_Scores_Print(uint8_t new_rank);
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file Input_Queue.c
+ *
+ * @brief Source code for the Input_Queue driver.
+ *
+ * This file contains the function definitions for the Input_Queue driver.
+ * More information about how the queue is shared is on the header code of the Input_Queue driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Input_Queue.h"
+#include "Profiler.h"
+#include "SPSC_Queue.h"
+#include "UART0.h"
+
+SPSC_QUEUE_DEFINE(events, Input_Event, INPUT_QUEUE_SIZE);
+
+static uint32_t latency_count[INPUT_SOURCE_COUNT];
+static uint32_t latency_total_us[INPUT_SOURCE_COUNT];
+static uint32_t latency_max_us[INPUT_SOURCE_COUNT];
+
+void Input_Queue_Init(void)
+{
+	SPSC_Queue_Flush(&events);
+
+	for (int i = 0; i < INPUT_SOURCE_COUNT; i++)
+	{
+		latency_count[i] = 0;
+		latency_total_us[i] = 0;
+		latency_max_us[i] = 0;
+	}
+}
+
+bool Input_Queue_Push(char key, uint8_t source)
+{
+	Input_Event event;
+	event.key = key;
+	event.source = source;
+	event.timestamp = PROFILER_CYCLES();
+	return SPSC_Queue_Push(&events, &event);
+}
+
+bool Input_Queue_Pop(Input_Event *event)
+{
+	return SPSC_Queue_Pop(&events, event);
+}
+
+bool Input_Queue_Pending(void)
+{
+	return SPSC_Queue_Count(&events) != 0;
+}
+
+uint32_t Input_Queue_High_Water(void)
+{
+	return SPSC_Queue_High_Water(&events);
+}
+
+void Input_Record_Latency(const Input_Event *event)
+{
+	uint32_t latency_us = Profiler_Cycles_To_us(PROFILER_CYCLES() - event->timestamp);
+
+	latency_count[event->source]++;
+	latency_total_us[event->source] += latency_us;
+	if (latency_us > latency_max_us[event->source])
+	{
+		latency_max_us[event->source] = latency_us;
+	}
+}
+
+void Input_Report_Latency(void)
+{
+	char *names[INPUT_SOURCE_COUNT] = {"Keyboard", "Buttons"};
+
+	for (int i = 0; i < INPUT_SOURCE_COUNT; i++)
+	{
+		UART0_Output_String(names[i]);
+		UART0_Output_String(" input latency: ");
+		if (latency_count[i] == 0)
+		{
+			UART0_Output_String("no direction changes");
+		}
+		else
+		{
+			UART0_Output_String("average ");
+			UART0_Output_Unsigned_Decimal(latency_total_us[i] / latency_count[i]);
+			UART0_Output_String(" us, maximum ");
+			UART0_Output_Unsigned_Decimal(latency_max_us[i]);
+			UART0_Output_String(" us");
+		}
+		UART0_Output_Newline();
+	}
+}
@@ -0,0 +1,106 @@
+/**
+ * @file Input_Queue.h
+ *
+ * @brief Header code for the Input_Queue driver.
+ *
+ * This file contains the function definitions for the Input_Queue driver.
+ * The Input_Queue driver carries input events from the interrupt service routines (UART0 receive
+ * and the EduBase buttons) to the main loop through an SPSC_Queue.
+ *
+ * The UART0 and GPIO Port D interrupts use the same priority, so they never preempt each other
+ * and only one of them pushes at a time. The main loop is the only reader, so no interrupt
+ * needs to be disabled.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef input_queue_header
+#define input_queue_header
+#include <stdint.h>
+#include <stdbool.h>
+
+// The size must be a power of two so that the indexes can wrap around with a mask
+#define INPUT_QUEUE_SIZE 16
+
+// Priority of every interrupt that pushes into the queue
+#define INPUT_INTERRUPT_PRIORITY 3
+
+#define INPUT_SOURCE_UART    0
+#define INPUT_SOURCE_BUTTON  1
+#define INPUT_SOURCE_COUNT   2
+
+typedef struct
+{
+	char key;           // Received character, or the button bit (0x01 - 0x08) for a button
+	uint8_t source;     // INPUT_SOURCE_UART or INPUT_SOURCE_BUTTON
+	uint32_t timestamp; // DWT cycle count when the interrupt occurred
+} Input_Event;
+
+/**
+ * @brief The Input_Queue_Init function empties the queue and clears the latency statistics.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Input_Queue_Init(void);
+
+/**
+ * @brief The Input_Queue_Push function adds an event to the queue. It is called from an
+ * interrupt service routine, and the event is timestamped with the DWT cycle counter.
+ *
+ * @param key The received character or button bit.
+ * @param source INPUT_SOURCE_UART or INPUT_SOURCE_BUTTON.
+ *
+ * @return False if the queue is full and the event was dropped; true otherwise.
+ */
+bool Input_Queue_Push(char key, uint8_t source);
+
+/**
+ * @brief The Input_Queue_Pop function removes the oldest event from the queue.
+ *
+ * @param event Pointer to where the event is stored.
+ *
+ * @return False if the queue is empty; true if an event was removed.
+ */
+bool Input_Queue_Pop(Input_Event *event);
+
+/**
+ * @brief The Input_Queue_Pending function checks if an event is waiting in the queue, without removing it.
+ *
+ * @param None
+ *
+ * @return True if the queue is not empty; false otherwise.
+ */
+bool Input_Queue_Pending(void);
+
+/**
+ * @brief The Input_Queue_High_Water function returns the largest number of events that were
+ * waiting in the queue at once since startup.
+ *
+ * @param None
+ *
+ * @return The high-water mark, up to INPUT_QUEUE_SIZE.
+ */
+uint32_t Input_Queue_High_Water(void);
+
+/**
+ * @brief The Input_Record_Latency function records the time from the interrupt of an event
+ * until the game applied it, for the source of the event.
+ *
+ * @param event Pointer to the event that was applied.
+ *
+ * @return None
+ */
+void Input_Record_Latency(const Input_Event *event);
+
+/**
+ * @brief The Input_Report_Latency function prints the average and maximum input latency of the
+ * keyboard and of the EduBase buttons to the serial terminal.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Input_Report_Latency(void);
+#endif
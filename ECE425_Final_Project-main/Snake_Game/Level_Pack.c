@@ -0,0 +1,178 @@
+/**
+ * @file Level_Pack.c
+ *
+ * @brief Source code for the Level_Pack driver.
+ *
+ * This file contains the function definitions for the Level_Pack driver.
+ * More information about the format of the walls is on the header code of the Level_Pack driver.
+ * The walls of the Box, Pillars, and Corridors levels are in Level_Walls.h, which is written from
+ * the text maps in Host_Tools/level_walls_gen.c.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Level_Pack.h"
+#include "Level_Walls.h"
+#include <string.h>
+
+// The levels without a name for the spawn use the center of the board
+#define LEVEL_CENTER_X (GRID_WIDTH / 2)
+#define LEVEL_CENTER_Y (GRID_HEIGHT / 2)
+
+static const uint8_t level_open_walls[] = {GRID_WIDTH, LEVEL_RUN_REPEAT, GRID_HEIGHT - 1};
+
+#if LARGE_BOARD
+// The pillars cover the center column of the small board, but not the one of the large board
+#define LEVEL_PILLARS_SPAWN_X LEVEL_CENTER_X
+#define LEVEL_PILLARS_SPAWN_Y LEVEL_CENTER_Y
+#else
+#define LEVEL_PILLARS_SPAWN_X 7
+#define LEVEL_PILLARS_SPAWN_Y LEVEL_CENTER_Y
+#endif
+
+const Level levels[LEVEL_COUNT] =
+{
+	{"Open field", level_open_walls, sizeof(level_open_walls), LEVEL_CENTER_X, LEVEL_CENTER_Y, RIGHT, LEVEL_FOOD_ANYWHERE},
+	{"Box", level_box_walls, sizeof(level_box_walls), LEVEL_CENTER_X, LEVEL_CENTER_Y, RIGHT, LEVEL_FOOD_ANYWHERE},
+	{"Pillars", level_pillars_walls, sizeof(level_pillars_walls), LEVEL_PILLARS_SPAWN_X, LEVEL_PILLARS_SPAWN_Y, UP, LEVEL_FOOD_AWAY_FROM_WALLS},
+	{"Corridors", level_corridors_walls, sizeof(level_corridors_walls), LEVEL_CENTER_X, LEVEL_CENTER_Y, LEFT, LEVEL_FOOD_ANYWHERE}
+};
+
+uint8_t level_selected = LEVEL_OPEN;
+uint8_t level_loaded = LEVEL_OPEN;
+uint8_t level_walls[(GRID_CELLS + 7) / 8];
+uint16_t level_wall_count = 0;
+
+// Rendered rows of the walls, and the row of the cache used by each row of the board
+static char row_templates[LEVEL_ROW_TEMPLATES][GRID_WIDTH];
+static uint8_t row_template_count = 0;
+static uint8_t row_template[GRID_HEIGHT];
+
+static void Level_Set_Walls(Cell cell, uint8_t count)
+{
+	level_wall_count += count;
+	while (count > 0)
+	{
+		// A run that covers a whole byte of the bitmap sets it at once
+		if ((cell & 0x07) == 0 && count >= 8)
+		{
+			level_walls[cell >> 3] = 0xFF;
+			cell += 8;
+			count -= 8;
+			continue;
+		}
+		level_walls[cell >> 3] |= 1 << (cell & 0x07);
+		cell++;
+		count--;
+	}
+}
+
+static uint8_t Level_Cache_Row(const char *row)
+{
+	for (uint8_t i = 0; i < row_template_count; i++)
+	{
+		if (memcmp(row_templates[i], row, GRID_WIDTH) == 0)
+		{
+			return i;
+		}
+	}
+
+	if (row_template_count == LEVEL_ROW_TEMPLATES)
+	{
+		return LEVEL_ROW_NONE;
+	}
+	memcpy(row_templates[row_template_count], row, GRID_WIDTH);
+	return row_template_count++;
+}
+
+// Decodes the runs of one row into row y, and returns the first byte after the runs
+static const uint8_t *Level_Decode_Row(const uint8_t *runs, uint8_t y)
+{
+	char row[GRID_WIDTH];
+	uint8_t x = 0;
+	bool wall = false;
+	while (x < GRID_WIDTH)
+	{
+		uint8_t run = *runs++;
+
+		// A run past the edge of the board is cut, so bad data cannot write past the row
+		if (run > GRID_WIDTH - x)
+		{
+			run = GRID_WIDTH - x;
+		}
+		memset(&row[x], wall ? '#' : '.', run);
+		if (wall)
+		{
+			Level_Set_Walls(CELL_OF(x, y), run);
+		}
+		x += run;
+		wall = !wall;
+	}
+	row_template[y] = Level_Cache_Row(row);
+	return runs;
+}
+
+void Level_Load(uint8_t index)
+{
+	memset(level_walls, 0, sizeof(level_walls));
+	level_wall_count = 0;
+	row_template_count = 0;
+	level_loaded = index;
+
+	const uint8_t *next = levels[index].walls;
+	const uint8_t *row = next;
+	uint8_t y = 0;
+	while (y < GRID_HEIGHT)
+	{
+		if (*next == LEVEL_RUN_REPEAT)
+		{
+			// The runs of the previous row are decoded again for each copy
+			for (uint8_t copy = 0; copy < next[1] && y < GRID_HEIGHT; copy++)
+			{
+				Level_Decode_Row(row, y);
+				y++;
+			}
+			next += 2;
+		}
+		else
+		{
+			row = next;
+			next = Level_Decode_Row(row, y);
+			y++;
+		}
+	}
+}
+
+bool Level_Wall(Cell cell)
+{
+	return (level_walls[cell >> 3] & (1 << (cell & 0x07))) != 0;
+}
+
+bool Level_Food_Allowed(Cell cell)
+{
+	if (levels[level_loaded].food_rule == LEVEL_FOOD_ANYWHERE)
+	{
+		return true;
+	}
+
+	uint8_t x = CELL_X(cell);
+	uint8_t y = CELL_Y(cell);
+	return (y == 0 || !Level_Wall(cell - GRID_WIDTH))
+		&& (y == GRID_HEIGHT - 1 || !Level_Wall(cell + GRID_WIDTH))
+		&& (x == 0 || !Level_Wall(cell - 1))
+		&& (x == GRID_WIDTH - 1 || !Level_Wall(cell + 1));
+}
+
+void Level_Render_Row(uint8_t y, char *row)
+{
+	if (row_template[y] != LEVEL_ROW_NONE)
+	{
+		memcpy(row, row_templates[row_template[y]], GRID_WIDTH);
+		return;
+	}
+
+	for (uint8_t x = 0; x < GRID_WIDTH; x++)
+	{
+		row[x] = Level_Wall(CELL_OF(x, y)) ? '#' : '.';
+	}
+}
@@ -0,0 +1,127 @@
+/**
+ * @file Level_Pack.h
+ *
+ * @brief Header code for the Level_Pack driver.
+ *
+ * This file contains the function definitions for the Level_Pack driver.
+ * A level is a set of walls on the board, the cell and direction of the head at the start,
+ * and a rule for the placement of the food. The levels are const data, so they stay in flash.
+ *
+ * The walls are stored as a compressed bitmap, row by row from the top:
+ *  - A row is a list of run lengths that alternate between free cells and walls, starting with
+ *    free cells (a row that starts with a wall starts with a run of 0). The runs of a row add up
+ *    to GRID_WIDTH.
+ *  - LEVEL_RUN_REPEAT followed by n repeats the row before it n more times.
+ * For example, the walls of the open level are {GRID_WIDTH, LEVEL_RUN_REPEAT, GRID_HEIGHT - 1}.
+ *
+ * Level_Load decompresses the walls into level_walls, which Game_Logic copies into the occupancy
+ * bitmap of the snake. A wall is then found by the same bit test as the body, so the walls add
+ * nothing to the cost of a tick.
+ *
+ * Level_Load also renders each row of the walls once, and keeps the different rows in a cache of
+ * LEVEL_ROW_TEMPLATES rows. A full redraw copies the cached row of the walls, and only looks up
+ * the cells that are not walls.
+ *
+ * The walls of each level are drawn as a text map in Host_Tools/level_walls_gen.c, which writes
+ * the runs into Level_Walls.h with the map above them. On the large board, each character of the
+ * map is a block of 4 x 4 cells.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef level_pack_header
+#define level_pack_header
+#include "Game_Logic.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define LEVEL_COUNT 4
+
+// The level without walls, used by the stress test and the bench command
+#define LEVEL_OPEN 0
+
+// Marks a repeat of the previous row in the compressed walls, since no run is longer than GRID_WIDTH
+#define LEVEL_RUN_REPEAT 0xFF
+
+// The most bytes of compressed walls in a level, which Game_Protocol sends in each keyframe
+#define LEVEL_MAX_WALLS_SIZE 64
+
+// Number of different rows of walls that are kept rendered for full redraws
+#define LEVEL_ROW_TEMPLATES 6
+
+// Marks a row that is not in the cache, which is rendered from level_walls instead
+#define LEVEL_ROW_NONE 0xFF
+
+typedef enum
+{
+	LEVEL_FOOD_ANYWHERE,
+	LEVEL_FOOD_AWAY_FROM_WALLS
+} Level_Food_Rule;
+
+typedef struct
+{
+	const char *name;
+	const uint8_t *walls;
+	uint8_t walls_size;
+	uint8_t spawn_x;
+	uint8_t spawn_y;
+	Direction direction;
+	Level_Food_Rule food_rule;
+} Level;
+
+extern const Level levels[LEVEL_COUNT];
+
+/**
+ * @brief The level picked on the title screen, and the level whose walls are loaded.
+ */
+extern uint8_t level_selected;
+extern uint8_t level_loaded;
+
+/**
+ * @brief One bit per cell, set when the cell is a wall of the loaded level. The bit of a cell is
+ * bit (cell % 8) of byte (cell / 8), as in snake_occupancy.
+ */
+extern uint8_t level_walls[(GRID_CELLS + 7) / 8];
+extern uint16_t level_wall_count;
+
+/**
+ * @brief The Level_Load function decompresses the walls of a level into level_walls and renders
+ * the cache of rows used by full redraws.
+ *
+ * @param index The number of the level, below LEVEL_COUNT.
+ *
+ * @return None
+ */
+void Level_Load(uint8_t index);
+
+/**
+ * @brief The Level_Wall function checks if a cell is a wall of the loaded level.
+ *
+ * @param cell The cell to check. It must be on the board.
+ *
+ * @return True if the cell is a wall; false otherwise.
+ */
+bool Level_Wall(Cell cell);
+
+/**
+ * @brief The Level_Food_Allowed function checks the food rule of the loaded level.
+ * With LEVEL_FOOD_AWAY_FROM_WALLS, the food is not placed next to a wall, where the snake
+ * could be trapped when it turns to eat.
+ *
+ * @param cell A free cell.
+ *
+ * @return True if the rule allows food in the cell; false otherwise.
+ */
+bool Level_Food_Allowed(Cell cell);
+
+/**
+ * @brief The Level_Render_Row function writes the walls of one row, '#' for a wall and '.' for
+ * every other cell, from the cache of rendered rows.
+ *
+ * @param y The row.
+ * @param row The GRID_WIDTH characters of the row.
+ *
+ * @return None
+ */
+void Level_Render_Row(uint8_t y, char *row);
+#endif
@@ -0,0 +1,174 @@
+/**
+ * @file Level_Walls.h
+ *
+ * @brief Compressed walls of the levels of the Level_Pack driver.
+ *
+ * This file is written by level_walls_gen in Host_Tools from the maps in level_walls_gen.c.
+ * Do not edit it; change the maps and run make levels in Host_Tools instead. make test checks
+ * that this file matches the maps. It is only included by Level_Pack.c.
+ *
+ * On the large board, each character of a map is a block of 4 x 4 cells.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef level_walls_header
+#define level_walls_header
+#include <stdint.h>
+
+#if LARGE_BOARD
+/*
+ * ................................
+ * ................................
+ * ....##########....##########....
+ * ....#......................#....
+ * ....#......................#....
+ * ....#......................#....
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * ....#......................#....
+ * ....#......................#....
+ * ....#......................#....
+ * ....##########....##########....
+ * ................................
+ * ................................
+ */
+static const uint8_t level_box_walls[] =
+{
+	128, 0xFF, 7,
+	16, 40, 16, 40, 16, 0xFF, 3,
+	16, 4, 88, 4, 16, 0xFF, 11,
+	128, 0xFF, 15,
+	16, 4, 88, 4, 16, 0xFF, 11,
+	16, 40, 16, 40, 16, 0xFF, 3,
+	128, 0xFF, 7
+};
+
+/*
+ * ................................
+ * ................................
+ * ...##.....##.....##.....##......
+ * ...##.....##.....##.....##......
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * ...##.....##.....##.....##......
+ * ...##.....##.....##.....##......
+ * ................................
+ * ................................
+ */
+static const uint8_t level_pillars_walls[] =
+{
+	128, 0xFF, 7,
+	12, 8, 20, 8, 20, 8, 20, 8, 24, 0xFF, 7,
+	128, 0xFF, 31,
+	12, 8, 20, 8, 20, 8, 20, 8, 24, 0xFF, 7,
+	128, 0xFF, 7
+};
+
+/*
+ * ................................
+ * .##############################.
+ * ................................
+ * ................................
+ * ................................
+ * .############.....#############.
+ * ................................
+ * ................................
+ * ................................
+ * ................................
+ * .############.....#############.
+ * ................................
+ * ................................
+ * ................................
+ * .##############################.
+ * ................................
+ */
+static const uint8_t level_corridors_walls[] =
+{
+	128, 0xFF, 3,
+	4, 120, 4, 0xFF, 3,
+	128, 0xFF, 11,
+	4, 48, 20, 52, 4, 0xFF, 3,
+	128, 0xFF, 15,
+	4, 48, 20, 52, 4, 0xFF, 3,
+	128, 0xFF, 11,
+	4, 120, 4, 0xFF, 3,
+	128, 0xFF, 3
+};
+#else
+/*
+ * ....................
+ * ....................
+ * ..######....######..
+ * ..#..............#..
+ * ..#..............#..
+ * ....................
+ * ..#..............#..
+ * ..######....######..
+ * ....................
+ * ....................
+ */
+static const uint8_t level_box_walls[] =
+{
+	20, 0xFF, 1,
+	2, 6, 4, 6, 2,
+	2, 1, 14, 1, 2, 0xFF, 1,
+	20,
+	2, 1, 14, 1, 2,
+	2, 6, 4, 6, 2,
+	20, 0xFF, 1
+};
+
+/*
+ * ....................
+ * ....................
+ * ...##....##....##...
+ * ...##....##....##...
+ * ....................
+ * ....................
+ * ...##....##....##...
+ * ...##....##....##...
+ * ....................
+ * ....................
+ */
+static const uint8_t level_pillars_walls[] =
+{
+	20, 0xFF, 1,
+	3, 2, 4, 2, 4, 2, 3, 0xFF, 1,
+	20, 0xFF, 1,
+	3, 2, 4, 2, 4, 2, 3, 0xFF, 1,
+	20, 0xFF, 1
+};
+
+/*
+ * ....................
+ * .##################.
+ * ....................
+ * ....................
+ * .#######....#######.
+ * ....................
+ * ....................
+ * .##################.
+ * ....................
+ * ....................
+ */
+static const uint8_t level_corridors_walls[] =
+{
+	20,
+	1, 18, 1,
+	20, 0xFF, 1,
+	1, 7, 4, 7, 1,
+	20, 0xFF, 1,
+	1, 18, 1,
+	20, 0xFF, 1
+};
+#endif
+#endif
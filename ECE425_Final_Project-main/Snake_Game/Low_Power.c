@@ -0,0 +1,168 @@
+/**
+ * @file Low_Power.c
+ *
+ * @brief Source code for the Low_Power driver.
+ *
+ * This file contains the function definitions for the Low_Power driver.
+ * More information about the clocks in sleep mode is on the header code of the Low_Power driver.
+ *
+ * @note For more information regarding the sleep modes, refer to the System Control section
+ * of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @note Assumes that the frequency of the system clock is 50 MHz.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "Low_Power.h"
+#include "UART0.h"
+
+// The times are added up in 64 bits, since a game can last longer than the 32-bit cycle counter
+static uint64_t active_cycles = 0;
+static uint64_t idle_cycles = 0;
+static uint32_t sleep_count = 0;
+
+// Time at which the core last woke up, or at which the stats were cleared, on Low_Power_Cycles
+static uint32_t last_wake_cycles = 0;
+
+// Time asleep that the DWT cycle counter did not count, which Low_Power_Cycles adds to it
+static uint32_t uncounted_sleep_cycles = 0;
+
+void Low_Power_Init(void)
+{
+	// Enable the clock to Timer 1 by setting the R1 bit (Bit 1) in the RCGCTIMER register
+	SYSCTL->RCGCTIMER |= 0x02;
+	
+	// Wait until Timer 1 is ready by checking the R1 bit (Bit 1) in the PRTIMER register
+	while ((SYSCTL->PRTIMER & 0x02) == 0);
+	
+	// Disable Timer A before the configuration by clearing the TAEN bit (Bit 0)
+	TIMER1->CTL &= ~0x01;
+	
+	// Use the 32-bit timer configuration in one-shot mode (TAMR, Bits 1 to 0) counting down
+	TIMER1->CFG = 0x00000000;
+	TIMER1->TAMR = 0x00000001;
+	
+	// Enable the time-out interrupt by setting the TATOIM bit (Bit 0)
+	TIMER1->ICR = 0x01;
+	TIMER1->IMR |= 0x01;
+	
+	NVIC_SetPriority(TIMER1A_IRQn, LOW_POWER_INTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(TIMER1A_IRQn);
+	
+	// Clocks in sleep mode: UART0 (R0) and UART1 (R1)
+	SYSCTL->SCGCUART = 0x03;
+	
+	// GPIO Port A (R0) and Port C (R2) for the UART pins, and Port D (R3) for the EduBase buttons
+	SYSCTL->SCGCGPIO = 0x0D;
+	
+	// Timer 0 (R0) for the game ticks and Timer 1 (R1) for the wake timer
+	SYSCTL->SCGCTIMER = 0x03;
+	
+	// The EEPROM (R0) finishes the word that it is programming
+	SYSCTL->SCGCEEPROM = 0x01;
+	
+	// Use the SCGC registers in sleep mode by setting the ACG bit (Bit 27) in the RCC register
+	SYSCTL->RCC |= 0x08000000;
+	
+	// WFI enters sleep mode, not deep-sleep mode, and the core returns to the main loop after each interrupt
+	SCB->SCR &= ~(SCB_SCR_SLEEPDEEP_Msk | SCB_SCR_SLEEPONEXIT_Msk);
+	
+	Low_Power_Reset_Stats();
+}
+
+void Low_Power_Sleep(uint32_t max_cycles)
+{
+	// A deadline that is already due is handled right away
+	if (max_cycles == 0)
+	{
+		return;
+	}
+	if (max_cycles > LOW_POWER_MAX_SLEEP_CYCLES)
+	{
+		max_cycles = LOW_POWER_MAX_SLEEP_CYCLES;
+	}
+	
+	// Loading the interval register of a disabled timer also loads the counter
+	TIMER1->CTL &= ~0x01;
+	TIMER1->TAILR = max_cycles - 1;
+	TIMER1->ICR = 0x01;
+	TIMER1->CTL |= 0x01;
+	
+	uint32_t sleep_cycles = PROFILER_CYCLES();
+	active_cycles += (sleep_cycles + uncounted_sleep_cycles) - last_wake_cycles;
+	
+	// Complete the memory accesses before the core stops
+	__DSB();
+	__WFI();
+	
+	// The wake timer stops at 0 when it times out, and its flag is only cleared by the handler, which
+	// runs after the caller enables the interrupts again
+	uint32_t slept_cycles = (TIMER1->RIS & 0x01) ? max_cycles : (max_cycles - 1) - TIMER1->TAV;
+	
+	// The wake timer is not needed once the core is awake, whatever woke it
+	TIMER1->CTL &= ~0x01;
+	
+	// The part of the sleep that the cycle counter counted is not added again
+	uint32_t counted_cycles = PROFILER_CYCLES() - sleep_cycles;
+	if (slept_cycles > counted_cycles)
+	{
+		uncounted_sleep_cycles += slept_cycles - counted_cycles;
+	}
+	idle_cycles += slept_cycles;
+	last_wake_cycles = Low_Power_Cycles();
+	sleep_count++;
+}
+
+uint32_t Low_Power_Cycles(void)
+{
+	return PROFILER_CYCLES() + uncounted_sleep_cycles;
+}
+
+void Low_Power_Reset_Stats(void)
+{
+	active_cycles = 0;
+	idle_cycles = 0;
+	sleep_count = 0;
+	last_wake_cycles = Low_Power_Cycles();
+}
+
+uint32_t Low_Power_Idle_Percent(void)
+{
+	uint64_t total_cycles = active_cycles + idle_cycles + (Low_Power_Cycles() - last_wake_cycles);
+	if (total_cycles == 0)
+	{
+		return 0;
+	}
+	return (uint32_t)((idle_cycles * 100) / total_cycles);
+}
+
+void Low_Power_Report(void)
+{
+	// The time since the last wake up has been spent awake
+	uint64_t active = active_cycles + (Low_Power_Cycles() - last_wake_cycles);
+	uint64_t total_cycles = active + idle_cycles;
+	uint32_t active_permille = (total_cycles == 0) ? 0 : (uint32_t)((active * 1000) / total_cycles);
+	
+	UART0_Output_String("CPU active ");
+	UART0_Output_Unsigned_Decimal(active_permille / 10);
+	UART0_Output_Character('.');
+	UART0_Output_Unsigned_Decimal(active_permille % 10);
+	UART0_Output_String("%, idle ");
+	UART0_Output_Unsigned_Decimal((1000 - active_permille) / 10);
+	UART0_Output_Character('.');
+	UART0_Output_Unsigned_Decimal((1000 - active_permille) % 10);
+	UART0_Output_String("% of ");
+	UART0_Output_Unsigned_Decimal((uint32_t)(total_cycles / PROFILER_CYCLES_PER_MS));
+	UART0_Output_String(" ms (");
+	UART0_Output_Unsigned_Decimal(sleep_count);
+	UART0_Output_String(" sleeps)");
+	UART0_Output_Newline();
+}
+
+void TIMER1A_Handler(void)
+{
+	// Clear the time-out flag by setting the TATOCINT bit (Bit 0) in the GPTMICR register
+	TIMER1->ICR = 0x01;
+}
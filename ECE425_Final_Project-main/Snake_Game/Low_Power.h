@@ -0,0 +1,127 @@
+/**
+ * @file Low_Power.h
+ *
+ * @brief Header code for the Low_Power driver.
+ *
+ * This file contains the function definitions for the Low_Power driver.
+ * When no state of the main loop has anything to do, the main loop puts the core in sleep mode
+ * with the WFI instruction until the next interrupt: a key on UART0, an EduBase button, a game
+ * tick of the Game_Timer driver, or a UART transmit interrupt.
+ *
+ * The other screens wait on a deadline of the DWT cycle counter, which cannot wake the core, so
+ * Timer 1A is used as a one-shot wake timer that ends the sleep at the deadline.
+ *
+ * In sleep mode, the clocks of the peripherals are set by the SCGC registers instead of the
+ * RCGC registers (the ACG bit in the RCC register). Only the modules that can wake the core or
+ * must keep working are clocked in sleep mode:
+ *  - UART0 and UART1, and GPIO Ports A and C for their pins
+ *  - GPIO Port D for the EduBase buttons
+ *  - Timer 0 (game ticks) and Timer 1 (wake timer)
+ *  - The EEPROM, since a word may still be programming when the core goes to sleep
+ * The outputs of GPIO Ports B and F (LEDs and phase trace pins) keep their value while their clock is off.
+ *
+ * Deep-sleep mode is not used, since it runs the system clock from another oscillator,
+ * which changes the tick period of Timer 0 and the baud rate of the UARTs.
+ *
+ * The DWT cycle counter may stop while the core sleeps, so the time spent asleep is measured with
+ * the wake timer instead: the cycles it counted down when another interrupt woke the core, or its
+ * whole interval when it timed out. The time is reported as the share of idle time of each game,
+ * and the part that the cycle counter missed is added to Low_Power_Cycles, the clock of the
+ * deadlines of the main loop.
+ *
+ * @note For more information regarding the sleep modes, refer to the System Control section
+ * of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @note Assumes that the frequency of the system clock is 50 MHz.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef low_power_header
+#define low_power_header
+#include "TM4C123GH6PM.h"
+#include "Profiler.h"
+#include <stdint.h>
+
+// The wake timer has nothing to do when it fires, so it uses the lowest priority
+#define LOW_POWER_INTERRUPT_PRIORITY 7
+
+// Longest sleep, so that the cycle counter cannot wrap around between two readings
+#define LOW_POWER_MAX_SLEEP_CYCLES (1000 * PROFILER_CYCLES_PER_MS)
+
+/**
+ * @brief The Low_Power_Init function sets the clocks of the peripherals in sleep mode,
+ * selects sleep mode instead of deep-sleep mode, and configures Timer 1A as the wake timer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Low_Power_Init(void);
+
+/**
+ * @brief The Low_Power_Sleep function puts the core in sleep mode until the next interrupt,
+ * or until the wake timer ends the sleep.
+ *
+ * It must be called with the interrupts disabled (PRIMASK set) after the caller has checked
+ * that nothing is ready. An interrupt that arrives after the check still ends the WFI instruction,
+ * and its handler runs when the caller enables the interrupts again, so it cannot be missed.
+ *
+ * @param max_cycles The longest time to sleep in system clock cycles. It is limited to
+ * LOW_POWER_MAX_SLEEP_CYCLES.
+ *
+ * @return None
+ */
+void Low_Power_Sleep(uint32_t max_cycles);
+
+/**
+ * @brief The Low_Power_Cycles function returns the DWT cycle count plus the time asleep that the
+ * cycle counter did not count, so a deadline on it is right whether or not the counter stops in
+ * sleep mode. Like the cycle counter, it wraps around every 86 seconds.
+ *
+ * @param None
+ *
+ * @return The time in system clock cycles.
+ */
+uint32_t Low_Power_Cycles(void);
+
+/**
+ * @brief The Low_Power_Reset_Stats function clears the active and idle times.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Low_Power_Reset_Stats(void);
+
+/**
+ * @brief The Low_Power_Idle_Percent function returns the share of the time spent asleep
+ * since the last call to Low_Power_Reset_Stats.
+ *
+ * @param None
+ *
+ * @return The idle time in percent, from 0 to 100.
+ */
+uint32_t Low_Power_Idle_Percent(void);
+
+/**
+ * @brief The Low_Power_Report function prints the active and idle times since the last call
+ * to Low_Power_Reset_Stats and the number of sleeps to the serial terminal.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Low_Power_Report(void);
+
+/**
+ * @brief The TIMER1A_Handler function is the interrupt service routine of the wake timer.
+ * The interrupt only ends the sleep, so the handler only clears the time-out flag.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void TIMER1A_Handler(void);
+#endif
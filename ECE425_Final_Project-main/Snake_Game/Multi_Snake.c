@@ -0,0 +1,544 @@
+/**
+ * @file Multi_Snake.c
+ *
+ * @brief Source code for the Multi_Snake driver.
+ *
+ * This file contains the function definitions for the Multi_Snake driver.
+ * More information about the storage of the snakes and the collisions is on the header code
+ * of the Multi_Snake driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Multi_Snake.h"
+#include "Difficulty.h"
+#include "UART0.h"
+#include <string.h>
+
+// Number of random cells tried before a free cell is searched in the grid, as in Food_Init
+#define MULTI_SNAKE_FOOD_ATTEMPTS 4
+
+uint8_t multi_snake_count = 0;
+uint8_t multi_snake_players = 0;
+
+Cell multi_snake_head[MULTI_SNAKE_MAX];
+Cell multi_snake_tail[MULTI_SNAKE_MAX];
+Cell multi_snake_last_tail[MULTI_SNAKE_MAX];
+uint16_t multi_snake_length[MULTI_SNAKE_MAX];
+Direction multi_snake_direction[MULTI_SNAKE_MAX];
+uint32_t multi_snake_score[MULTI_SNAKE_MAX];
+bool multi_snake_alive[MULTI_SNAKE_MAX];
+bool multi_snake_grew[MULTI_SNAKE_MAX];
+
+const char multi_snake_glyph[MULTI_SNAKE_MAX] = {'O', 'X', '#', '&'};
+
+// The direction of the next move, set by a player or by the computer
+static Direction next_direction[MULTI_SNAKE_MAX];
+
+// Ring buffer of 2-bit directions of each body, four per byte. Entry chain_tail[n] is the move
+// from the tail of snake n to the next segment, and the entries that follow lead to the head.
+static uint8_t chain[MULTI_SNAKE_MAX][(MULTI_SNAKE_MAX_LENGTH + 3) / 4];
+static uint16_t chain_tail[MULTI_SNAKE_MAX];
+
+// Shared occupancy grid, two cells per byte: the entry of a cell is bits 4 * (cell % 2)
+// to 4 * (cell % 2) + 3 of byte cell / 2
+static uint8_t grid[(GRID_CELLS + 1) / 2];
+
+// The move that would reverse each direction into the body
+static const Direction opposite_direction[4] = {DOWN, UP, RIGHT, LEFT};
+
+static void Grid_Set(Cell cell, uint8_t owner)
+{
+	uint8_t shift = (cell & 0x01) << 2;
+	grid[cell >> 1] = (grid[cell >> 1] & ~(0x0F << shift)) | (owner << shift);
+}
+
+static uint16_t Chain_Index(uint32_t index)
+{
+	if (index >= MULTI_SNAKE_MAX_LENGTH)
+	{
+		index -= MULTI_SNAKE_MAX_LENGTH;
+	}
+	return index;
+}
+
+static void Chain_Write(uint8_t snake, uint16_t index, Direction direction)
+{
+	uint8_t shift = (index & 0x03) << 1;
+	chain[snake][index >> 2] = (chain[snake][index >> 2] & ~(0x03 << shift)) | (direction << shift);
+}
+
+static Direction Chain_Read(uint8_t snake, uint16_t index)
+{
+	return (Direction)((chain[snake][index >> 2] >> ((index & 0x03) << 1)) & 0x03);
+}
+
+static bool Multi_Snake_Hits_Wall(Cell head, Direction direction)
+{
+	switch (direction)
+	{
+		case UP:
+		{
+			return head < GRID_WIDTH;
+		}
+		case DOWN:
+		{
+			return head >= GRID_CELLS - GRID_WIDTH;
+		}
+		case LEFT:
+		{
+			return CELL_X(head) == 0;
+		}
+		default:
+		{
+			return CELL_X(head) == GRID_WIDTH - 1;
+		}
+	}
+}
+
+static uint16_t Multi_Snake_Distance(Cell a, Cell b)
+{
+	uint8_t dx = (CELL_X(a) > CELL_X(b)) ? CELL_X(a) - CELL_X(b) : CELL_X(b) - CELL_X(a);
+	uint8_t dy = (CELL_Y(a) > CELL_Y(b)) ? CELL_Y(a) - CELL_Y(b) : CELL_Y(b) - CELL_Y(a);
+	return dx + dy;
+}
+
+static bool Multi_Snake_Move_Safe(uint8_t snake, Direction direction)
+{
+	if (Multi_Snake_Hits_Wall(multi_snake_head[snake], direction))
+	{
+		return false;
+	}
+	
+	// The own tail leaves its cell during the move, unless the snake eats
+	Cell next = multi_snake_head[snake] + cell_delta[direction];
+	return Multi_Snake_Owner(next) == 0 || (next == multi_snake_tail[snake] && next != food);
+}
+
+// The same greedy move as the demo of the Attract_Mode driver: the safe move closest to the food
+static Direction Multi_Snake_AI_Direction(uint8_t snake)
+{
+	Direction current = multi_snake_direction[snake];
+	Direction best_direction = current;
+	uint16_t best_distance = 0xFFFF;
+	
+	if (Multi_Snake_Move_Safe(snake, current))
+	{
+		best_distance = Multi_Snake_Distance(multi_snake_head[snake] + cell_delta[current], food);
+	}
+	
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		Direction direction = (Direction)i;
+		if (direction == current || direction == opposite_direction[current])
+		{
+			continue;
+		}
+		if (Multi_Snake_Move_Safe(snake, direction))
+		{
+			uint16_t distance = Multi_Snake_Distance(multi_snake_head[snake] + cell_delta[direction], food);
+			if (distance < best_distance)
+			{
+				best_direction = direction;
+				best_distance = distance;
+			}
+		}
+	}
+	return best_direction;
+}
+
+static void Multi_Snake_Place_Food(void)
+{
+	uint16_t used_cells = 0;
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		if (multi_snake_alive[i])
+		{
+			used_cells += multi_snake_length[i];
+		}
+	}
+	
+	uint16_t free_cells = GRID_CELLS - used_cells;
+	if (free_cells == 0)
+	{
+		food = CELL_NONE;
+		return;
+	}
+	
+	for (int attempt = 0; attempt < MULTI_SNAKE_FOOD_ATTEMPTS; attempt++)
+	{
+		food = Game_Random() % GRID_CELLS;
+		if (Multi_Snake_Owner(food) == 0)
+		{
+			return;
+		}
+	}
+	
+	// Pick a random free cell by counting the free cells in the grid
+	uint16_t skip = Game_Random() % free_cells;
+	Cell cell = 0;
+	while (cell < GRID_CELLS)
+	{
+		if (Multi_Snake_Owner(cell) == 0)
+		{
+			if (skip == 0)
+			{
+				break;
+			}
+			skip--;
+		}
+		cell++;
+	}
+	food = cell;
+}
+
+static void Multi_Snake_Set_Speed(void)
+{
+	// The snakes share the tick, which speeds up with the best score, and game_score changes
+	// with any score so that the HUD is redrawn
+	uint32_t best_score = 0;
+	game_score = 0;
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		game_score += multi_snake_score[i];
+		if (multi_snake_score[i] > best_score)
+		{
+			best_score = multi_snake_score[i];
+		}
+	}
+	snake_period = Difficulty_Period(best_score);
+	snake_delay_ms = snake_period / DIFFICULTY_US(1000);
+}
+
+static void Multi_Snake_Remove(uint8_t snake)
+{
+	// The tail may have left its cell to another head during this tick, so only the cells
+	// that the snake still owns are freed
+	Cell cell = multi_snake_tail[snake];
+	for (uint16_t i = 0; i < multi_snake_length[snake]; i++)
+	{
+		if (Multi_Snake_Owner(cell) == snake + 1)
+		{
+			Grid_Set(cell, 0);
+		}
+		if (i < multi_snake_length[snake] - 1)
+		{
+			cell += cell_delta[Chain_Read(snake, Chain_Index(chain_tail[snake] + i))];
+		}
+	}
+	multi_snake_alive[snake] = false;
+}
+
+uint8_t Multi_Snake_Owner(Cell cell)
+{
+	return (grid[cell >> 1] >> ((cell & 0x01) << 2)) & 0x0F;
+}
+
+void Multi_Snake_Init(uint8_t count, uint8_t players)
+{
+	memset(grid, 0, sizeof(grid));
+	multi_snake_count = count;
+	multi_snake_players = players;
+	
+	for (uint8_t i = 0; i < count; i++)
+	{
+		// Even snakes start at the left wall heading right, and odd snakes at the right wall heading left
+		uint8_t y = ((i + 1) * GRID_HEIGHT) / (count + 1);
+		Direction direction = (i % 2 == 0) ? RIGHT : LEFT;
+		Cell tail = (i % 2 == 0) ? CELL_OF(1, y) : CELL_OF(GRID_WIDTH - 2, y);
+		
+		multi_snake_tail[i] = tail;
+		multi_snake_head[i] = tail + ((INITIAL_SNAKE_LENGTH - 1) * cell_delta[direction]);
+		multi_snake_last_tail[i] = tail;
+		multi_snake_length[i] = INITIAL_SNAKE_LENGTH;
+		multi_snake_direction[i] = direction;
+		next_direction[i] = direction;
+		multi_snake_score[i] = 0;
+		multi_snake_alive[i] = true;
+		multi_snake_grew[i] = false;
+		chain_tail[i] = 0;
+		
+		Cell cell = tail;
+		for (uint16_t segment = 0; segment < INITIAL_SNAKE_LENGTH; segment++)
+		{
+			Grid_Set(cell, i + 1);
+			if (segment < INITIAL_SNAKE_LENGTH - 1)
+			{
+				Chain_Write(i, segment, direction);
+			}
+			cell += cell_delta[direction];
+		}
+	}
+	
+	Multi_Snake_Place_Food();
+	Multi_Snake_Set_Speed();
+}
+
+void Multi_Snake_End(void)
+{
+	multi_snake_count = 0;
+}
+
+bool Multi_Snake_Key(char key)
+{
+	uint8_t snake;
+	Direction direction;
+	
+	switch (key)
+	{
+		case 'W':
+		case 'w':
+		{
+			snake = 0;
+			direction = UP;
+			break;
+		}
+		case 'S':
+		case 's':
+		{
+			snake = 0;
+			direction = DOWN;
+			break;
+		}
+		case 'A':
+		case 'a':
+		{
+			snake = 0;
+			direction = LEFT;
+			break;
+		}
+		case 'D':
+		case 'd':
+		{
+			snake = 0;
+			direction = RIGHT;
+			break;
+		}
+		case 'I':
+		case 'i':
+		{
+			snake = 1;
+			direction = UP;
+			break;
+		}
+		case 'K':
+		case 'k':
+		{
+			snake = 1;
+			direction = DOWN;
+			break;
+		}
+		case 'J':
+		case 'j':
+		{
+			snake = 1;
+			direction = LEFT;
+			break;
+		}
+		case 'L':
+		case 'l':
+		{
+			snake = 1;
+			direction = RIGHT;
+			break;
+		}
+		default:
+		{
+			return false;
+		}
+	}
+	
+	// The reverse is checked against the last move, since several keys may arrive in one tick
+	if (snake >= multi_snake_players || !multi_snake_alive[snake] || direction == opposite_direction[multi_snake_direction[snake]])
+	{
+		return false;
+	}
+	next_direction[snake] = direction;
+	return true;
+}
+
+uint8_t Multi_Snake_Step(void)
+{
+	Cell next_head[MULTI_SNAKE_MAX];
+	bool claimed[MULTI_SNAKE_MAX];
+	bool eats[MULTI_SNAKE_MAX];
+	uint8_t crashed = 0;
+	bool food_eaten = false;
+	
+	// Every tail leaves its cell before any head moves, so a head may follow any tail
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		claimed[i] = false;
+		eats[i] = false;
+		multi_snake_grew[i] = false;
+		if (!multi_snake_alive[i])
+		{
+			continue;
+		}
+		
+		if (i >= multi_snake_players)
+		{
+			next_direction[i] = Multi_Snake_AI_Direction(i);
+		}
+		if (Multi_Snake_Hits_Wall(multi_snake_head[i], next_direction[i]))
+		{
+			crashed |= 1 << i;
+			continue;
+		}
+		
+		next_head[i] = multi_snake_head[i] + cell_delta[next_direction[i]];
+		// A snake that has its share of the board still eats, but keeps its length
+		eats[i] = next_head[i] == food;
+		multi_snake_grew[i] = eats[i] && multi_snake_length[i] < MULTI_SNAKE_MAX_LENGTH;
+		if (!multi_snake_grew[i])
+		{
+			multi_snake_last_tail[i] = multi_snake_tail[i];
+			Grid_Set(multi_snake_tail[i], 0);
+		}
+	}
+	
+	// Each head claims its cell. The owner of a cell that is not free tells if it is a body
+	// or a head that claimed it during this tick.
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		if (!multi_snake_alive[i] || (crashed & (1 << i)))
+		{
+			continue;
+		}
+		
+		uint8_t owner = Multi_Snake_Owner(next_head[i]);
+		if (owner == 0)
+		{
+			Grid_Set(next_head[i], i + 1);
+			claimed[i] = true;
+			continue;
+		}
+		
+		crashed |= 1 << i;
+		uint8_t other = owner - 1;
+		if (claimed[other] && next_head[other] == next_head[i])
+		{
+			crashed |= 1 << other;
+		}
+	}
+	
+	// The snakes that crashed are removed, and the others take their move
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		if (!multi_snake_alive[i])
+		{
+			continue;
+		}
+		
+		if (crashed & (1 << i))
+		{
+			if (claimed[i])
+			{
+				Grid_Set(next_head[i], 0);
+			}
+			multi_snake_grew[i] = false;
+			Multi_Snake_Remove(i);
+			continue;
+		}
+		
+		Chain_Write(i, Chain_Index(chain_tail[i] + multi_snake_length[i] - 1), next_direction[i]);
+		if (eats[i])
+		{
+			multi_snake_score[i]++;
+			food_eaten = true;
+		}
+		if (multi_snake_grew[i])
+		{
+			multi_snake_length[i]++;
+		}
+		else
+		{
+			multi_snake_tail[i] += cell_delta[Chain_Read(i, chain_tail[i])];
+			chain_tail[i] = Chain_Index(chain_tail[i] + 1);
+		}
+		multi_snake_head[i] = next_head[i];
+		multi_snake_direction[i] = next_direction[i];
+	}
+	
+	if (food_eaten)
+	{
+		Multi_Snake_Place_Food();
+		Multi_Snake_Set_Speed();
+	}
+	return crashed;
+}
+
+bool Multi_Snake_Playing(void)
+{
+	uint8_t snakes_left = 0;
+	uint8_t players_left = 0;
+	
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		if (multi_snake_alive[i])
+		{
+			snakes_left++;
+			if (i < multi_snake_players)
+			{
+				players_left++;
+			}
+		}
+	}
+	return snakes_left >= 2 && players_left != 0;
+}
+
+static void Multi_Snake_Output_Name(uint8_t snake)
+{
+	if (snake < multi_snake_players)
+	{
+		UART0_Output_String("Player ");
+		UART0_Output_Unsigned_Decimal(snake + 1);
+	}
+	else
+	{
+		UART0_Output_String("Computer ");
+		UART0_Output_Unsigned_Decimal(snake + 1 - multi_snake_players);
+	}
+	UART0_Output_String(" (");
+	UART0_Output_Character(multi_snake_glyph[snake]);
+	UART0_Output_Character(')');
+}
+
+void Multi_Snake_Report(void)
+{
+	uint8_t snakes_left = 0;
+	uint8_t winner = 0;
+	
+	for (uint8_t i = 0; i < multi_snake_count; i++)
+	{
+		Multi_Snake_Output_Name(i);
+		UART0_Output_String(": ");
+		UART0_Output_Unsigned_Decimal(multi_snake_score[i]);
+		UART0_Output_String(" points");
+		if (multi_snake_alive[i])
+		{
+			snakes_left++;
+			winner = i;
+		}
+		else
+		{
+			UART0_Output_String(", crashed");
+		}
+		UART0_Output_Newline();
+	}
+	
+	if (snakes_left == 1)
+	{
+		Multi_Snake_Output_Name(winner);
+		UART0_Output_String(" wins!");
+	}
+	else if (snakes_left == 0)
+	{
+		UART0_Output_String("Draw! Every snake crashed.");
+	}
+	else
+	{
+		UART0_Output_String("The computer wins!");
+	}
+	UART0_Output_Newline();
+}
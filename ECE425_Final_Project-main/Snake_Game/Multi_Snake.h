@@ -0,0 +1,142 @@
+/**
+ * @file Multi_Snake.h
+ *
+ * @brief Header code for the Multi_Snake driver.
+ *
+ * This file contains the function definitions for the Multi_Snake driver.
+ * It plays a game with two to MULTI_SNAKE_MAX snakes on one board, which share one food.
+ * Player 1 steers the first snake with W, A, S, and D (or the EduBase buttons), player 2 steers
+ * the second snake with I, J, K, and L on the same terminal, and the other snakes are steered by
+ * the computer.
+ *
+ * The snakes are stored as a structure of arrays: each field (head, tail, length, direction, ...)
+ * is an array indexed by the number of the snake, and each body is a ring buffer of 2-bit
+ * directions like the body of the single snake when SNAKE_DIRECTION_CHAIN is 1.
+ *
+ * The board is a shared occupancy grid with one 4-bit entry per cell, which holds the number of
+ * the snake in the cell plus one, or 0 if the cell is free. A tick resolves every collision with
+ * one pass over the snakes:
+ *  - Each snake finds the cell of its next head, and its tail leaves its cell unless it eats.
+ *  - Each head then claims its cell in the grid. A head that finds a body in the cell crashes.
+ *    A head that finds a cell claimed by another head during the same tick crashes with it, which
+ *    is found with one compare against the next head of the owner of the cell.
+ * The cost of a tick grows linearly with the number of snakes. When a snake crashes, its body is
+ * removed from the board, which takes one step per segment.
+ *
+ * The game ends when fewer than two snakes are left, or when no player is left.
+ * The board of this game is always open and bounded by walls, whatever the level and board_wrap are.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef multi_snake_header
+#define multi_snake_header
+#include "Game_Logic.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MULTI_SNAKE_MAX 4
+
+// The board is shared, so each snake stops growing at its share of the cells
+#define MULTI_SNAKE_MAX_LENGTH (GRID_CELLS / MULTI_SNAKE_MAX)
+
+/**
+ * @brief The number of snakes in the game, and the number of them that are steered by players.
+ * multi_snake_count is 0 when the single snake game is played.
+ */
+extern uint8_t multi_snake_count;
+extern uint8_t multi_snake_players;
+
+/**
+ * @brief The fields of each snake, indexed by the number of the snake.
+ * multi_snake_last_tail is the cell vacated by the tail during the last tick, and
+ * multi_snake_grew is true if the snake ate during the last tick and kept its tail.
+ */
+extern Cell multi_snake_head[MULTI_SNAKE_MAX];
+extern Cell multi_snake_tail[MULTI_SNAKE_MAX];
+extern Cell multi_snake_last_tail[MULTI_SNAKE_MAX];
+extern uint16_t multi_snake_length[MULTI_SNAKE_MAX];
+extern Direction multi_snake_direction[MULTI_SNAKE_MAX];
+extern uint32_t multi_snake_score[MULTI_SNAKE_MAX];
+extern bool multi_snake_alive[MULTI_SNAKE_MAX];
+extern bool multi_snake_grew[MULTI_SNAKE_MAX];
+
+/**
+ * @brief The character that draws each snake on the terminal.
+ */
+extern const char multi_snake_glyph[MULTI_SNAKE_MAX];
+
+/**
+ * @brief The Multi_Snake_Init function starts a new game. The snakes start on evenly spaced rows,
+ * heading right from the left wall and left from the right wall in turn.
+ *
+ * game_score is set to the sum of the scores, so a renderer knows when a score changes, and
+ * snake_period is set from the difficulty curve with the highest score.
+ *
+ * @param count The number of snakes, from 2 to MULTI_SNAKE_MAX.
+ * @param players The number of snakes steered by players, 1 or 2.
+ *
+ * @return None
+ */
+void Multi_Snake_Init(uint8_t count, uint8_t players);
+
+/**
+ * @brief The Multi_Snake_End function returns to the single snake game, so renderers draw
+ * the single snake again.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Multi_Snake_End(void);
+
+/**
+ * @brief The Multi_Snake_Key function steers the snake of a player. W, A, S, and D steer
+ * player 1, and I, J, K, and L steer player 2. A key that would reverse the snake into its
+ * body is ignored.
+ *
+ * @param key The key typed by a player.
+ *
+ * @return True if the key steered a snake; false otherwise.
+ */
+bool Multi_Snake_Key(char key);
+
+/**
+ * @brief The Multi_Snake_Step function runs the logic of one tick for every snake: the computer
+ * picks the moves of its snakes, every snake moves, the collisions are resolved, and new food
+ * is placed if a snake ate.
+ *
+ * @param None
+ *
+ * @return A bit field of the snakes that crashed during this tick (bit n for snake n).
+ */
+uint8_t Multi_Snake_Step(void);
+
+/**
+ * @brief The Multi_Snake_Playing function checks if the game goes on.
+ *
+ * @param None
+ *
+ * @return False if fewer than two snakes are left or no player is left; true otherwise.
+ */
+bool Multi_Snake_Playing(void);
+
+/**
+ * @brief The Multi_Snake_Owner function reads the shared occupancy grid.
+ *
+ * @param cell The cell to read. It must be on the board.
+ *
+ * @return The number of the snake in the cell plus one, or 0 if the cell is free.
+ */
+uint8_t Multi_Snake_Owner(Cell cell);
+
+/**
+ * @brief The Multi_Snake_Report function prints the score of each snake and the winner
+ * to the serial terminal.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Multi_Snake_Report(void);
+#endif
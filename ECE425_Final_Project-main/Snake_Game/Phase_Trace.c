@@ -0,0 +1,172 @@
+/**
+ * @file Phase_Trace.c
+ *
+ * @brief Source code for the Phase_Trace driver.
+ *
+ * This file contains the function definitions for the Phase_Trace driver.
+ * More information about the trace pins is on the header code of the Phase_Trace driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Phase_Trace.h"
+#include "Profiler.h"
+#include "UART0.h"
+
+typedef struct
+{
+	uint32_t cycles;
+	uint8_t phase;
+	uint8_t level;
+} Phase_Toggle;
+
+static Phase_Toggle toggles[PHASE_TRACE_CAPTURE_SIZE];
+static uint32_t toggle_count = 0;
+
+void Phase_Trace_Init(void)
+{
+	// Enable the clock to Port B
+	SYSCTL->RCGCGPIO |= 0x02;
+
+	// Set PB4, PB5, PB6, and PB7 as output GPIO pins
+	GPIOB->DIR |= 0xF0;
+
+	// Configure PB4, PB5, PB6, and PB7 to function as GPIO pins
+	GPIOB->AFSEL &= ~0xF0;
+
+	// Enable digital functionality for PB4, PB5, PB6, and PB7
+	GPIOB->DEN |= 0xF0;
+
+	// Drive the trace pins low
+	PHASE_TRACE_PIN(0xF0) = 0;
+
+	toggle_count = 0;
+}
+
+void Phase_Trace_Record(uint8_t phase, uint8_t level)
+{
+	Phase_Toggle *toggle = &toggles[toggle_count % PHASE_TRACE_CAPTURE_SIZE];
+	toggle->cycles = PROFILER_CYCLES();
+	toggle->phase = phase;
+	toggle->level = level;
+	toggle_count++;
+}
+
+// The VCD identifier of a pin mask: 0x10 to 0x80 become 'a' to 'd'
+static char Phase_Trace_Identifier(uint8_t phase)
+{
+	char identifier = 'a';
+	for (uint8_t mask = phase >> 4; mask > 1; mask >>= 1)
+	{
+		identifier++;
+	}
+	return identifier;
+}
+
+// Prints a number of cycles in units of the 10 ns timescale. Twice the cycles does not fit in
+// 32 bits after 43 seconds, so the digits are taken from a 64-bit value.
+static void Phase_Trace_Output_Time(uint32_t cycles)
+{
+	uint64_t time = (uint64_t)cycles * 2;
+	char digits[20];
+	int length = 0;
+	do
+	{
+		digits[length++] = '0' + (time % 10);
+		time /= 10;
+	} while (time > 0);
+
+	UART0_Output_Character('#');
+	while (length > 0)
+	{
+		UART0_Output_Character(digits[--length]);
+	}
+	UART0_Output_Newline();
+}
+
+void Phase_Trace_Dump_VCD(void)
+{
+	char *names[4] = {"input", "logic", "render", "delay"};
+	uint32_t first = 0;
+	uint32_t count = toggle_count;
+
+	if (count > PHASE_TRACE_CAPTURE_SIZE)
+	{
+		first = count - PHASE_TRACE_CAPTURE_SIZE;
+	}
+
+	// A cycle is 20 ns, which is not a timescale allowed by VCD (1, 10, or 100 of a unit),
+	// so the times are written in units of 10 ns
+	UART0_Output_String("$timescale 10 ns $end");
+	UART0_Output_Newline();
+	UART0_Output_String("$scope module tick $end");
+	UART0_Output_Newline();
+
+	// Each phase uses one printable character ('a' to 'd') as its VCD identifier
+	for (int i = 0; i < 4; i++)
+	{
+		UART0_Output_String("$var wire 1 ");
+		UART0_Output_Character('a' + i);
+		UART0_Output_Character(' ');
+		UART0_Output_String(names[i]);
+		UART0_Output_String(" $end");
+		UART0_Output_Newline();
+	}
+	UART0_Output_String("$upscope $end");
+	UART0_Output_Newline();
+	UART0_Output_String("$enddefinitions $end");
+	UART0_Output_Newline();
+
+	// The value of each pin before its first toggle in the buffer is the opposite of that toggle.
+	// A pin that does not toggle in the buffer is low, as set by Phase_Trace_Init.
+	uint8_t initial_levels = 0;
+	uint8_t seen = 0;
+	for (uint32_t i = first; i < count; i++)
+	{
+		Phase_Toggle *toggle = &toggles[i % PHASE_TRACE_CAPTURE_SIZE];
+		if ((seen & toggle->phase) == 0)
+		{
+			seen |= toggle->phase;
+			if (toggle->level == 0)
+			{
+				initial_levels |= toggle->phase;
+			}
+		}
+	}
+
+	UART0_Output_String("#0");
+	UART0_Output_Newline();
+	UART0_Output_String("$dumpvars");
+	UART0_Output_Newline();
+	for (uint8_t phase = PHASE_TRACE_INPUT; phase != 0; phase <<= 1)
+	{
+		UART0_Output_Character((initial_levels & phase) ? '1' : '0');
+		UART0_Output_Character(Phase_Trace_Identifier(phase));
+		UART0_Output_Newline();
+	}
+	UART0_Output_String("$end");
+	UART0_Output_Newline();
+
+	if (first == count)
+	{
+		return;
+	}
+
+	uint32_t start_cycles = toggles[first % PHASE_TRACE_CAPTURE_SIZE].cycles;
+	uint32_t last_cycles = 0;
+	for (uint32_t i = first; i < count; i++)
+	{
+		Phase_Toggle *toggle = &toggles[i % PHASE_TRACE_CAPTURE_SIZE];
+		uint32_t cycles = toggle->cycles - start_cycles;
+
+		// Toggles at the same time share one time stamp, and the first one shares #0
+		if (cycles != last_cycles)
+		{
+			Phase_Trace_Output_Time(cycles);
+			last_cycles = cycles;
+		}
+		UART0_Output_Character('0' + toggle->level);
+		UART0_Output_Character(Phase_Trace_Identifier(toggle->phase));
+		UART0_Output_Newline();
+	}
+}
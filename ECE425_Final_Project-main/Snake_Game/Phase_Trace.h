@@ -0,0 +1,88 @@
+/**
+ * @file Phase_Trace.h
+ *
+ * @brief Header code for the Phase_Trace driver.
+ *
+ * This file contains the function definitions for the Phase_Trace driver.
+ * The Phase_Trace driver drives one spare GPIO pin high during each phase of a game tick, so the
+ * timing of a tick can be viewed on a logic analyzer:
+ *  - PB4: Input phase (reading the Input_Queue)
+ *  - PB5: Logic phase (moving the snake and checking collisions)
+ *  - PB6: Render phase (Draw_Frame)
+ *  - PB7: Delay phase (waiting for the next tick)
+ *
+ * The pins are next to the EduBase LEDs (PB0 - PB3). Each pin is written through the masked
+ * GPIODATA address, where address bits 9 to 2 select which pins a store changes, so a toggle is
+ * a single store with no read-modify-write of the other Port B pins.
+ *
+ * Every toggle is also recorded with its DWT cycle count in a RAM buffer, and Phase_Trace_Dump_VCD
+ * prints the buffer as a Value Change Dump (VCD) file, so the same waveform can be viewed
+ * without a logic analyzer by logging the serial terminal to a file.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef phase_trace_header
+#define phase_trace_header
+#include "TM4C123GH6PM.h"
+#include <stdint.h>
+
+// Set to 0 to remove every trace toggle from the build
+#ifndef PHASE_TRACE_ENABLED
+#define PHASE_TRACE_ENABLED 1
+#endif
+
+// Number of toggles kept in RAM; the oldest toggles are overwritten
+#define PHASE_TRACE_CAPTURE_SIZE 256
+
+#define PHASE_TRACE_INPUT   0x10
+#define PHASE_TRACE_LOGIC   0x20
+#define PHASE_TRACE_RENDER  0x40
+#define PHASE_TRACE_DELAY   0x80
+
+/**
+ * @brief The masked GPIODATA address of Port B that only changes the pins in mask.
+ */
+#define PHASE_TRACE_PIN(mask) (*((volatile uint32_t *)(GPIOB_BASE + ((mask) << 2))))
+
+#if PHASE_TRACE_ENABLED
+#define PHASE_TRACE_BEGIN(phase) do { PHASE_TRACE_PIN(phase) = (phase); Phase_Trace_Record((phase), 1); } while (0)
+#define PHASE_TRACE_END(phase)   do { PHASE_TRACE_PIN(phase) = 0; Phase_Trace_Record((phase), 0); } while (0)
+#else
+#define PHASE_TRACE_BEGIN(phase) do { } while (0)
+#define PHASE_TRACE_END(phase)   do { } while (0)
+#endif
+
+/**
+ * @brief The Phase_Trace_Init function initializes PB4 - PB7 as output pins driven low,
+ * and empties the capture buffer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Phase_Trace_Init(void);
+
+/**
+ * @brief The Phase_Trace_Record function saves one toggle in the capture buffer.
+ *
+ * @param phase One of the PHASE_TRACE_ pin masks.
+ * @param level 1 when the phase begins; 0 when it ends.
+ *
+ * @return None
+ */
+void Phase_Trace_Record(uint8_t phase, uint8_t level);
+
+/**
+ * @brief The Phase_Trace_Dump_VCD function prints the capture buffer as a VCD file.
+ *
+ * The timescale is 10 ns, so each system clock cycle (20 ns) is two units of time, and the time
+ * of the oldest toggle is 0. The $dumpvars block at time 0 gives the level of every pin before
+ * its first toggle in the buffer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Phase_Trace_Dump_VCD(void);
+#endif
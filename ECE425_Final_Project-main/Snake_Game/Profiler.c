@@ -0,0 +1,27 @@
+/**
+ * @file Profiler.c
+ *
+ * @brief Source code for the Profiler driver.
+ *
+ * This file contains the function definitions for the Profiler driver.
+ * More information about the DWT cycle counter is on the header code of the Profiler driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Profiler.h"
+
+void Profiler_Init(void)
+{
+	// Enable the DWT unit by setting the TRCENA bit (Bit 24) in the DEMCR register
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+
+	// Enable the cycle counter by setting the CYCCNTENA bit (Bit 0) in the CTRL register.
+	// It is not cleared, since the Reset_Handler already started it for the Boot_Profile driver.
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+uint32_t Profiler_Cycles_To_us(uint32_t cycles)
+{
+	return cycles / PROFILER_CYCLES_PER_US;
+}
@@ -0,0 +1,49 @@
+/**
+ * @file Profiler.h
+ *
+ * @brief Header code for the Profiler driver.
+ *
+ * This file contains the function definitions for the Profiler driver.
+ * It uses the cycle counter (CYCCNT) of the Data Watchpoint and Trace (DWT) unit in the
+ * Cortex-M4 core to measure elapsed time without using an interrupt.
+ *
+ * @note Assumes that the frequency of the system clock is 50 MHz. The 32-bit cycle counter
+ * wraps around after about 85 seconds, so only differences between two readings are used.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef profiler_header
+#define profiler_header
+#include "TM4C123GH6PM.h"
+#include <stdint.h>
+
+#define PROFILER_CYCLES_PER_US 50
+#define PROFILER_CYCLES_PER_MS (PROFILER_CYCLES_PER_US * 1000)
+
+/**
+ * @brief Reads the current value of the DWT cycle counter.
+ */
+#define PROFILER_CYCLES() (DWT->CYCCNT)
+
+/**
+ * @brief The Profiler_Init function enables the DWT cycle counter. The counter is not cleared,
+ * so it keeps counting from reset when the Reset_Handler started it.
+ *
+ * The TRCENA bit (Bit 24) in the DEMCR register must be set before the DWT unit can be used.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Profiler_Init(void);
+
+/**
+ * @brief The Profiler_Cycles_To_us function converts a number of cycles into microseconds.
+ *
+ * @param cycles The number of system clock cycles.
+ *
+ * @return The number of microseconds.
+ */
+uint32_t Profiler_Cycles_To_us(uint32_t cycles);
+#endif
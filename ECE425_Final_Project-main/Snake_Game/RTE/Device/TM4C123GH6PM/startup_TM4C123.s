@@ -49,6 +49,15 @@ Heap_Mem        SPACE   Heap_Size
 __heap_limit
 
 
+; Cycle count at the end of SystemInit, read by the Boot_Profile driver.
+; The area is NOINIT, so __main does not clear it before main.
+
+                AREA    BOOT_PROFILE, NOINIT, READWRITE, ALIGN=2
+                EXPORT  Boot_System_Init_Cycles
+Boot_System_Init_Cycles
+                SPACE   4
+
+
                 PRESERVE8
                 THUMB
 
@@ -232,8 +241,23 @@ Reset_Handler   PROC
                 EXPORT  Reset_Handler             [WEAK]
                 IMPORT  SystemInit
                 IMPORT  __main
+                ; Start the DWT cycle counter from 0, so the boot is timed from reset
+                LDR     R0, =0xE000EDFC           ; DEMCR
+                LDR     R1, [R0]
+                ORR     R1, R1, #0x01000000       ; TRCENA
+                STR     R1, [R0]
+                LDR     R0, =0xE0001000           ; DWT_CTRL
+                MOVS    R1, #0
+                STR     R1, [R0, #4]              ; DWT_CYCCNT
+                LDR     R1, [R0]
+                ORR     R1, R1, #0x00000001       ; CYCCNTENA
+                STR     R1, [R0]
                 LDR     R0, =SystemInit
                 BLX     R0
+                LDR     R0, =0xE0001004           ; DWT_CYCCNT
+                LDR     R1, [R0]
+                LDR     R0, =Boot_System_Init_Cycles
+                STR     R1, [R0]
                 LDR     R0, =__main
                 BX      R0
                 ENDP
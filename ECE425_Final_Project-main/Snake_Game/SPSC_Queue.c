@@ -0,0 +1,161 @@
+/**
+ * @file SPSC_Queue.c
+ *
+ * @brief Source code for the SPSC_Queue driver.
+ *
+ * This file contains the function definitions for the SPSC_Queue driver.
+ * More information about the memory ordering is on the header code of the SPSC_Queue driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "SPSC_Queue.h"
+#include <string.h>
+
+static uint8_t *SPSC_Queue_Slot(const SPSC_Queue *queue, uint32_t index)
+{
+	return &queue->buffer[(index & queue->mask) * queue->element_size];
+}
+
+// Copies count elements between the ring and a block, in two pieces if the ring wraps around
+static void SPSC_Queue_Copy(const SPSC_Queue *queue, uint32_t index, uint8_t *block, uint32_t count, bool into_ring)
+{
+	uint32_t first = (queue->mask + 1) - (index & queue->mask);
+	if (first > count)
+	{
+		first = count;
+	}
+	uint32_t first_bytes = first * queue->element_size;
+	uint32_t second_bytes = (count - first) * queue->element_size;
+
+	if (into_ring)
+	{
+		memcpy(SPSC_Queue_Slot(queue, index), block, first_bytes);
+		memcpy(queue->buffer, block + first_bytes, second_bytes);
+	}
+	else
+	{
+		memcpy(block, SPSC_Queue_Slot(queue, index), first_bytes);
+		memcpy(block + first_bytes, queue->buffer, second_bytes);
+	}
+}
+
+static void SPSC_Queue_Publish(SPSC_Queue *queue, uint32_t head)
+{
+	// The elements must be written before the consumer can see the new head
+	__DMB();
+	queue->head = head;
+
+	uint32_t count = head - queue->tail;
+	if (count > queue->high_water)
+	{
+		queue->high_water = count;
+	}
+}
+
+bool SPSC_Queue_Push(SPSC_Queue *queue, const void *element)
+{
+	uint32_t head = queue->head;
+	if (head - queue->tail > queue->mask)
+	{
+		return false;
+	}
+
+	memcpy(SPSC_Queue_Slot(queue, head), element, queue->element_size);
+	SPSC_Queue_Publish(queue, head + 1);
+	return true;
+}
+
+uint32_t SPSC_Queue_Push_Bulk(SPSC_Queue *queue, const void *elements, uint32_t count)
+{
+	uint32_t head = queue->head;
+	uint32_t free_slots = (queue->mask + 1) - (head - queue->tail);
+	if (count > free_slots)
+	{
+		count = free_slots;
+	}
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	SPSC_Queue_Copy(queue, head, (uint8_t *)elements, count, true);
+	SPSC_Queue_Publish(queue, head + count);
+	return count;
+}
+
+bool SPSC_Queue_Pop(SPSC_Queue *queue, void *element)
+{
+	uint32_t tail = queue->tail;
+	if (tail == queue->head)
+	{
+		return false;
+	}
+
+	// The element is only read after the head that covers it
+	__DMB();
+	memcpy(element, SPSC_Queue_Slot(queue, tail), queue->element_size);
+
+	// The element must be read before the producer can reuse its slot
+	__DMB();
+	queue->tail = tail + 1;
+	return true;
+}
+
+uint32_t SPSC_Queue_Pop_Bulk(SPSC_Queue *queue, void *elements, uint32_t count)
+{
+	uint32_t tail = queue->tail;
+	uint32_t available = queue->head - tail;
+	if (count > available)
+	{
+		count = available;
+	}
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	__DMB();
+	SPSC_Queue_Copy(queue, tail, (uint8_t *)elements, count, false);
+	__DMB();
+	queue->tail = tail + count;
+	return count;
+}
+
+const void *SPSC_Queue_Peek(SPSC_Queue *queue)
+{
+	uint32_t tail = queue->tail;
+	if (tail == queue->head)
+	{
+		return 0;
+	}
+
+	__DMB();
+	return SPSC_Queue_Slot(queue, tail);
+}
+
+void SPSC_Queue_Skip(SPSC_Queue *queue)
+{
+	__DMB();
+	queue->tail = queue->tail + 1;
+}
+
+void SPSC_Queue_Flush(SPSC_Queue *queue)
+{
+	queue->tail = queue->head;
+}
+
+uint32_t SPSC_Queue_Count(const SPSC_Queue *queue)
+{
+	return queue->head - queue->tail;
+}
+
+uint32_t SPSC_Queue_Free(const SPSC_Queue *queue)
+{
+	return (queue->mask + 1) - (queue->head - queue->tail);
+}
+
+uint32_t SPSC_Queue_High_Water(const SPSC_Queue *queue)
+{
+	return queue->high_water;
+}
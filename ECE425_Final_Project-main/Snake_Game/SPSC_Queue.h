@@ -0,0 +1,152 @@
+/**
+ * @file SPSC_Queue.h
+ *
+ * @brief Header code for the SPSC_Queue driver.
+ *
+ * This file contains the function definitions for the SPSC_Queue driver.
+ * An SPSC_Queue is a single-producer, single-consumer ring buffer of fixed-size elements, used to
+ * hand data between an interrupt service routine and the main loop without disabling interrupts.
+ *
+ *  - The head index is only written by the producer and the tail index only by the consumer.
+ *    Both indexes run freely and wrap around at 2^32, and the element of an index is found by
+ *    masking it, so the capacity must be a power of two. The queue is full when head - tail
+ *    equals the capacity, so every slot is used.
+ *  - The producer writes the element, then a data memory barrier (DMB), then the new head, so the
+ *    consumer can never see the head move before the element is written. The consumer reads the
+ *    element, then a DMB, then writes the new tail, so the producer can never reuse a slot that is
+ *    still being read.
+ *  - Only one producer and one consumer may use a queue. Several interrupts can share the producer
+ *    side only if they have the same priority, so they never preempt each other.
+ *
+ * The high-water mark is the largest number of elements that were waiting in the queue at once,
+ * and shows how close the queue came to being full.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef spsc_queue_header
+#define spsc_queue_header
+#include "TM4C123GH6PM.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+	uint8_t *buffer;            // capacity * element_size bytes
+	uint16_t element_size;      // Size of one element in bytes
+	uint32_t mask;              // capacity - 1
+	volatile uint32_t head;     // Written by the producer only
+	volatile uint32_t tail;     // Written by the consumer only
+	uint32_t high_water;        // Written by the producer only
+} SPSC_Queue;
+
+/**
+ * @brief Defines a queue named name of capacity elements of type, with its own storage.
+ * The capacity must be a power of two.
+ */
+#define SPSC_QUEUE_DEFINE(name, type, capacity) \
+	static type name##_storage[capacity]; \
+	static SPSC_Queue name = {(uint8_t *)name##_storage, sizeof(type), (capacity) - 1, 0, 0, 0}
+
+/**
+ * @brief The SPSC_Queue_Push function adds one element. It is called by the producer only.
+ *
+ * @param queue Pointer to the queue.
+ * @param element Pointer to the element that is copied into the queue.
+ *
+ * @return False if the queue is full and the element was dropped; true otherwise.
+ */
+bool SPSC_Queue_Push(SPSC_Queue *queue, const void *element);
+
+/**
+ * @brief The SPSC_Queue_Push_Bulk function adds up to count elements with at most two copies.
+ * It is called by the producer only.
+ *
+ * @param queue Pointer to the queue.
+ * @param elements Pointer to the elements that are copied into the queue.
+ * @param count The number of elements.
+ *
+ * @return The number of elements that were added, which is less than count if the queue filled up.
+ */
+uint32_t SPSC_Queue_Push_Bulk(SPSC_Queue *queue, const void *elements, uint32_t count);
+
+/**
+ * @brief The SPSC_Queue_Pop function removes the oldest element. It is called by the consumer only.
+ *
+ * @param queue Pointer to the queue.
+ * @param element Pointer to where the element is copied.
+ *
+ * @return False if the queue is empty; true if an element was removed.
+ */
+bool SPSC_Queue_Pop(SPSC_Queue *queue, void *element);
+
+/**
+ * @brief The SPSC_Queue_Pop_Bulk function removes up to count of the oldest elements with at most
+ * two copies. It is called by the consumer only.
+ *
+ * @param queue Pointer to the queue.
+ * @param elements Pointer to where the elements are copied.
+ * @param count The largest number of elements to remove.
+ *
+ * @return The number of elements that were removed.
+ */
+uint32_t SPSC_Queue_Pop_Bulk(SPSC_Queue *queue, void *elements, uint32_t count);
+
+/**
+ * @brief The SPSC_Queue_Peek function returns a pointer to the oldest element without removing it,
+ * so the consumer can use it in place. It is called by the consumer only.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return A pointer to the oldest element, or a null pointer if the queue is empty.
+ */
+const void *SPSC_Queue_Peek(SPSC_Queue *queue);
+
+/**
+ * @brief The SPSC_Queue_Skip function removes the oldest element after SPSC_Queue_Peek.
+ * It is called by the consumer only, and the queue must not be empty.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return None
+ */
+void SPSC_Queue_Skip(SPSC_Queue *queue);
+
+/**
+ * @brief The SPSC_Queue_Flush function removes every element. It is called by the consumer only.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return None
+ */
+void SPSC_Queue_Flush(SPSC_Queue *queue);
+
+/**
+ * @brief The SPSC_Queue_Count function returns the number of elements in the queue.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return The number of elements, which may already be out of date when the other side is running.
+ */
+uint32_t SPSC_Queue_Count(const SPSC_Queue *queue);
+
+/**
+ * @brief The SPSC_Queue_Free function returns the number of elements that can still be added.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return The number of free slots. The producer can rely on it, since only the consumer can
+ * change it, and only upwards.
+ */
+uint32_t SPSC_Queue_Free(const SPSC_Queue *queue);
+
+/**
+ * @brief The SPSC_Queue_High_Water function returns the largest number of elements that were
+ * in the queue at once.
+ *
+ * @param queue Pointer to the queue.
+ *
+ * @return The high-water mark.
+ */
+uint32_t SPSC_Queue_High_Water(const SPSC_Queue *queue);
+#endif
@@ -0,0 +1,323 @@
+/**
+ * @file Save_State.c
+ *
+ * @brief Source code for the Save_State driver.
+ *
+ * This file contains the function definitions for the Save_State driver.
+ * More information about the snapshot and journal formats is on the header code of the
+ * Save_State driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Save_State.h"
+#include "Difficulty.h"
+#include "Level_Pack.h"
+#include "CRC16.h"
+
+#define SAVE_STATE_MOVES_WORD 7
+#define SAVE_STATE_CRC_WORD (SAVE_STATE_SNAPSHOT_WORDS - 1)
+#define SAVE_STATE_TICK_MASK 0x00FFFFFF
+#define SAVE_STATE_JOURNAL_MARKER 0xA0
+
+// The snapshot being written, or the snapshot being loaded
+static uint32_t snapshot[SAVE_STATE_SNAPSHOT_WORDS];
+
+static bool saving = false;
+static uint32_t tick;
+
+// Slot and tick number of the newest snapshot, which may still be being written
+static uint8_t snapshot_slot;
+static uint32_t snapshot_tick;
+
+// Number of words of the newest snapshot that are written or being written
+static uint8_t snapshot_words_written;
+
+// Moves of the ticks whose journal words wait for the EEPROM, from journal_tick to tick
+static Direction journal_queue[SAVE_STATE_JOURNAL_QUEUE];
+static uint32_t journal_tick;
+
+static uint8_t Save_State_Slot_Block(uint8_t slot)
+{
+	return SAVE_STATE_FIRST_BLOCK + (slot * SAVE_STATE_SLOT_BLOCKS);
+}
+
+static void Save_State_Start_Write(uint8_t first_block, uint16_t word, uint32_t data)
+{
+	EEPROM_Write_Word(first_block + (word / EEPROM_WORDS_PER_BLOCK), word % EEPROM_WORDS_PER_BLOCK, data);
+}
+
+// Waits until the EEPROM is free, so it is only used outside of the game ticks
+static void Save_State_Write(uint8_t first_block, uint16_t word, uint32_t data)
+{
+	while (EEPROM_Busy());
+	Save_State_Start_Write(first_block, word, data);
+}
+
+static uint32_t Save_State_Read(uint8_t first_block, uint16_t word)
+{
+	while (EEPROM_Busy());
+	return EEPROM_Read_Word(first_block + (word / EEPROM_WORDS_PER_BLOCK), word % EEPROM_WORDS_PER_BLOCK);
+}
+
+static uint32_t Save_State_Journal_Word(uint32_t journal_tick, Direction moved)
+{
+	return ((journal_tick & SAVE_STATE_TICK_MASK) << 8) | SAVE_STATE_JOURNAL_MARKER | ((~moved & 0x03) << 2) | moved;
+}
+
+// Starts the oldest waiting journal word, or else the next word of the snapshot, if the EEPROM is free
+static void Save_State_Start_Next_Word(void)
+{
+	if (!saving || EEPROM_Busy())
+	{
+		return;
+	}
+
+	if (journal_tick != tick + 1)
+	{
+		Direction moved = journal_queue[journal_tick % SAVE_STATE_JOURNAL_QUEUE];
+		Save_State_Start_Write(SAVE_STATE_JOURNAL_FIRST_BLOCK, (journal_tick & SAVE_STATE_TICK_MASK) % SAVE_STATE_JOURNAL_WORDS,
+			Save_State_Journal_Word(journal_tick, moved));
+		journal_tick++;
+	}
+	else if (snapshot_words_written < SAVE_STATE_SNAPSHOT_WORDS)
+	{
+		Save_State_Start_Write(Save_State_Slot_Block(snapshot_slot), snapshot_words_written, snapshot[snapshot_words_written]);
+		snapshot_words_written++;
+	}
+}
+
+static uint16_t Save_State_Snapshot_CRC(void)
+{
+	return CRC16_Update(CRC16_INITIAL, (const uint8_t *)snapshot, SAVE_STATE_CRC_WORD * sizeof(uint32_t));
+}
+
+static bool Save_State_Capture(void)
+{
+	uint8_t *moves = (uint8_t *)&snapshot[SAVE_STATE_MOVES_WORD];
+	uint16_t moves_size = (SAVE_STATE_CRC_WORD - SAVE_STATE_MOVES_WORD) * sizeof(uint32_t);
+
+	if (!Snake_Save_Body(moves, moves_size))
+	{
+		return false;
+	}
+
+	snapshot[0] = SAVE_STATE_TAG;
+	snapshot[1] = tick;
+	snapshot[2] = game_score;
+	snapshot[3] = snake_length | ((uint32_t)current_direction << 16) | ((uint32_t)level_loaded << 24) | ((uint32_t)board_wrap << 31);
+	snapshot[4] = snake_tail | ((uint32_t)food << 16);
+	snapshot[5] = random_state;
+	snapshot[6] = snake_period;
+	snapshot[SAVE_STATE_CRC_WORD] = Save_State_Snapshot_CRC();
+	return true;
+}
+
+static bool Save_State_Load_Slot(uint8_t slot)
+{
+	for (int i = 0; i < SAVE_STATE_SNAPSHOT_WORDS; i++)
+	{
+		snapshot[i] = Save_State_Read(Save_State_Slot_Block(slot), i);
+	}
+	return snapshot[0] == SAVE_STATE_TAG && snapshot[SAVE_STATE_CRC_WORD] == Save_State_Snapshot_CRC();
+}
+
+static bool Save_State_Journal_Word_Valid(uint32_t word)
+{
+	return (word & 0xF0) == SAVE_STATE_JOURNAL_MARKER && ((word >> 2) & 0x03) == (~word & 0x03);
+}
+
+static bool Save_State_Read_Journal(uint32_t journal_tick, Direction *moved)
+{
+	uint32_t word = Save_State_Read(SAVE_STATE_JOURNAL_FIRST_BLOCK, (journal_tick & SAVE_STATE_TICK_MASK) % SAVE_STATE_JOURNAL_WORDS);
+
+	// A word left by an older tick, or torn by a reset while it was written, is not used
+	if (!Save_State_Journal_Word_Valid(word) || (word >> 8) != (journal_tick & SAVE_STATE_TICK_MASK))
+	{
+		return false;
+	}
+	*moved = (Direction)(word & 0x03);
+	return true;
+}
+
+void Save_State_Begin(void)
+{
+	// The tick numbers continue after the newest journal word, so the words left by an earlier
+	// game can never be taken as ticks of this game
+	tick = 0;
+	for (int i = 0; i < SAVE_STATE_JOURNAL_WORDS; i++)
+	{
+		uint32_t word = Save_State_Read(SAVE_STATE_JOURNAL_FIRST_BLOCK, i);
+		if (Save_State_Journal_Word_Valid(word) && (word >> 8) > tick)
+		{
+			tick = word >> 8;
+		}
+	}
+
+	saving = Save_State_Capture();
+	if (!saving)
+	{
+		return;
+	}
+
+	for (int i = 0; i < SAVE_STATE_SNAPSHOT_WORDS; i++)
+	{
+		Save_State_Write(Save_State_Slot_Block(0), i, snapshot[i]);
+	}
+	Save_State_Write(Save_State_Slot_Block(1), 0, 0);
+
+	snapshot_slot = 0;
+	snapshot_tick = tick;
+	snapshot_words_written = SAVE_STATE_SNAPSHOT_WORDS;
+	journal_tick = tick + 1;
+}
+
+void Save_State_Tick(Direction moved)
+{
+	if (!saving)
+	{
+		return;
+	}
+
+	// When the EEPROM falls too far behind, the game can no longer be saved. The words already in
+	// the EEPROM are kept, so the game resumes at the last journaled tick.
+	if (tick + 1 - journal_tick == SAVE_STATE_JOURNAL_QUEUE)
+	{
+		saving = false;
+		return;
+	}
+
+	tick++;
+	journal_queue[tick % SAVE_STATE_JOURNAL_QUEUE] = moved;
+
+	if (snapshot_words_written == SAVE_STATE_SNAPSHOT_WORDS && tick - snapshot_tick >= SAVE_STATE_COMPACTION_INTERVAL)
+	{
+		// The snake is too long for a snapshot, which is handled the same way. Emptying the slots
+		// would wait for the EEPROM.
+		if (!Save_State_Capture())
+		{
+			saving = false;
+			return;
+		}
+		snapshot_slot ^= 1;
+		snapshot_tick = tick;
+		snapshot_words_written = 0;
+	}
+
+	Save_State_Start_Next_Word();
+}
+
+void Save_State_Poll(void)
+{
+	Save_State_Start_Next_Word();
+}
+
+bool Save_State_Busy(void)
+{
+	return saving && (journal_tick != tick + 1 || snapshot_words_written < SAVE_STATE_SNAPSHOT_WORDS);
+}
+
+void Save_State_Checkpoint(void)
+{
+	if (!saving)
+	{
+		return;
+	}
+
+	// A slot that is still being written is not complete, so it is written again
+	uint8_t slot = snapshot_slot;
+	if (snapshot_words_written == SAVE_STATE_SNAPSHOT_WORDS)
+	{
+		slot ^= 1;
+	}
+
+	if (!Save_State_Capture())
+	{
+		Save_State_End();
+		return;
+	}
+
+	for (int i = 0; i < SAVE_STATE_SNAPSHOT_WORDS; i++)
+	{
+		Save_State_Write(Save_State_Slot_Block(slot), i, snapshot[i]);
+	}
+
+	// The other slot can hold a snapshot of this tick from before the change, which must not be resumed
+	Save_State_Write(Save_State_Slot_Block(slot ^ 1), 0, 0);
+
+	// The waiting journal words are of ticks that the new snapshot already holds
+	snapshot_slot = slot;
+	snapshot_tick = tick;
+	snapshot_words_written = SAVE_STATE_SNAPSHOT_WORDS;
+	journal_tick = tick + 1;
+}
+
+void Save_State_End(void)
+{
+	Save_State_Write(Save_State_Slot_Block(0), 0, 0);
+	Save_State_Write(Save_State_Slot_Block(1), 0, 0);
+	saving = false;
+}
+
+bool Save_State_Resume(void)
+{
+	bool found = false;
+	uint8_t newest_slot = 0;
+	uint32_t newest_tick = 0;
+
+	for (uint8_t slot = 0; slot < 2; slot++)
+	{
+		if (Save_State_Load_Slot(slot) && (!found || snapshot[1] > newest_tick))
+		{
+			found = true;
+			newest_slot = slot;
+			newest_tick = snapshot[1];
+		}
+	}
+
+	if (!found || !Save_State_Load_Slot(newest_slot))
+	{
+		return false;
+	}
+
+	// The body is rebuilt on the walls of the level it was saved on, and with the same edges
+	uint8_t level = (snapshot[3] >> 24) & 0x7F;
+	if (level >= LEVEL_COUNT)
+	{
+		return false;
+	}
+	Level_Load(level);
+	level_selected = level;
+	board_wrap = (snapshot[3] >> 31) != 0;
+	Snake_Load_Body(snapshot[4] & 0xFFFF, snapshot[3] & 0xFFFF, (const uint8_t *)&snapshot[SAVE_STATE_MOVES_WORD]);
+	current_direction = (Direction)((snapshot[3] >> 16) & 0xFF);
+	food = snapshot[4] >> 16;
+	game_score = snapshot[2];
+	random_state = snapshot[5];
+	snake_period = snapshot[6];
+	snake_delay_ms = snake_period / DIFFICULTY_US(1000);
+
+	// Apply the ticks after the snapshot until the first journal word that is missing
+	tick = newest_tick;
+	Direction moved;
+	while (Save_State_Read_Journal(tick + 1, &moved))
+	{
+		current_direction = moved;
+		Game_Step();
+		tick++;
+	}
+
+	// The game was over before it could be emptied
+	if (Check_Collision())
+	{
+		Save_State_End();
+		return false;
+	}
+
+	saving = true;
+	snapshot_slot = newest_slot;
+	snapshot_tick = newest_tick;
+	snapshot_words_written = SAVE_STATE_SNAPSHOT_WORDS;
+	journal_tick = tick + 1;
+	return true;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file Save_State.h
+ *
+ * @brief Header code for the Save_State driver.
+ *
+ * This file contains the function definitions for the Save_State driver.
+ * The Save_State driver keeps the running game in the EEPROM, so it can be resumed after a
+ * reset or a power loss.
+ *
+ * The EEPROM blocks after the High_Scores blocks hold two snapshot slots and a journal:
+ *  - A snapshot is SAVE_STATE_SNAPSHOT_WORDS words with the whole game state:
+ *
+ *    Word(s)     Field
+ *    0           SAVE_STATE_TAG (format version and board size), or 0 if the slot is empty
+ *    1           Tick number of the snapshot
+ *    2           Score
+ *    3           Snake length (bits 15 - 0), direction (bits 23 - 16), level (bits 30 - 24),
+ *                and wrap-around edges (bit 31)
+ *    4           Tail cell (bits 15 - 0) and food cell (bits 31 - 16)
+ *    5           State of the random number generator
+ *    6           Tick period in 1/256 us
+ *    7 to 30     Moves from the tail to the head, as stored by Snake_Save_Body
+ *    31          CRC-16/CCITT-FALSE of words 0 to 30 in the lower half
+ *
+ *  - The journal is a ring of one word per tick. With t the low 24 bits of the tick number, the
+ *    word of a tick is at index (t % SAVE_STATE_JOURNAL_WORDS), and holds t in bits 31 - 8, 0xA in
+ *    bits 7 - 4, the inverted direction in bits 3 - 2, and the direction of the move in bits 1 - 0.
+ *    Since every word holds its own tick number, and a new game numbers its ticks after the newest
+ *    word in the journal, old words never need to be erased.
+ *
+ * Each tick adds one journal word, so the cost of a tick does not depend on the snake length.
+ * Every SAVE_STATE_COMPACTION_INTERVAL ticks, a new snapshot is captured in RAM and written to the
+ * other slot, one word at a time with the CRC last. The older slot stays valid until the new one
+ * is complete.
+ *
+ * Programming a word takes milliseconds, so a tick never waits for the EEPROM. The journal words
+ * wait in a queue of SAVE_STATE_JOURNAL_QUEUE ticks, and Save_State_Tick and Save_State_Poll each
+ * start at most one waiting word, journal words first, and only when EEPROM_Busy returns false.
+ * The snapshot words are written between ticks by Save_State_Poll.
+ *
+ * Save_State_Checkpoint writes a whole snapshot at once. It is used when the game state is changed
+ * outside of Game_Step, such as by the seed command of the Debug_Console, which the journal
+ * cannot replay.
+ *
+ * To resume, the newest valid snapshot is loaded and the journal words of the ticks after it
+ * are applied with Game_Step. Nothing is drawn until the game state is rebuilt, so the terminal
+ * is rebuilt with one full redraw.
+ *
+ * @note Each journal word is programmed once every SAVE_STATE_JOURNAL_WORDS ticks. The snapshot
+ * holds up to SAVE_STATE_MAX_MOVES moves, so on the large board, saving stops when the snake is longer.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef save_state_header
+#define save_state_header
+#include "Game_Logic.h"
+#include "High_Scores.h"
+#include "EEPROM.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SAVE_STATE_VERSION 4
+#define SAVE_STATE_TAG (0x53530000 | (SAVE_STATE_VERSION << 8) | LARGE_BOARD)
+
+#define SAVE_STATE_SNAPSHOT_WORDS (EEPROM_WORDS_PER_BLOCK * 2)
+#define SAVE_STATE_MAX_MOVES ((SAVE_STATE_SNAPSHOT_WORDS - 8) * 16)
+
+// Two snapshot slots, followed by the journal in the rest of the EEPROM
+#define SAVE_STATE_FIRST_BLOCK (HIGH_SCORES_FIRST_BLOCK + HIGH_SCORES_BLOCK_COUNT)
+#define SAVE_STATE_SLOT_BLOCKS (SAVE_STATE_SNAPSHOT_WORDS / EEPROM_WORDS_PER_BLOCK)
+#define SAVE_STATE_JOURNAL_FIRST_BLOCK (SAVE_STATE_FIRST_BLOCK + (2 * SAVE_STATE_SLOT_BLOCKS))
+#define SAVE_STATE_JOURNAL_WORDS ((EEPROM_BLOCK_COUNT - SAVE_STATE_JOURNAL_FIRST_BLOCK) * EEPROM_WORDS_PER_BLOCK)
+
+// The journal must keep every tick since the older snapshot while the newer one is written
+#define SAVE_STATE_COMPACTION_INTERVAL (SAVE_STATE_JOURNAL_WORDS / 2)
+
+// Number of ticks whose journal words can wait for the EEPROM (a power of 2)
+#define SAVE_STATE_JOURNAL_QUEUE 16
+
+/**
+ * @brief The Save_State_Begin function starts saving a new game. It writes a snapshot of the
+ * state set by Game_Init to the first slot and empties the second slot.
+ *
+ * It waits for the EEPROM, so it is called before the first tick of the game.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Save_State_Begin(void);
+
+/**
+ * @brief The Save_State_Tick function queues the journal word of one tick, and starts the oldest
+ * waiting word if the EEPROM is free. It never waits for the EEPROM.
+ *
+ * If the queue is full, the EEPROM has fallen too far behind and saving stops, as it does when the
+ * snake is too long for a snapshot. The saved game can still be resumed at the last tick that was
+ * journaled.
+ *
+ * @param moved The direction of the move made by Game_Step during this tick.
+ *
+ * @return None
+ */
+void Save_State_Tick(Direction moved);
+
+/**
+ * @brief The Save_State_Poll function starts the next waiting journal or snapshot word if the
+ * EEPROM is free. It never waits for the EEPROM, so it is called on every pass of the main loop.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Save_State_Poll(void);
+
+/**
+ * @brief The Save_State_Busy function checks if words are waiting to be written, in which case
+ * the main loop must keep calling Save_State_Poll instead of sleeping.
+ *
+ * @param None
+ *
+ * @return True if a journal or snapshot word is waiting; false otherwise.
+ */
+bool Save_State_Busy(void);
+
+/**
+ * @brief The Save_State_Checkpoint function writes a snapshot of the current game state, so a change
+ * that Game_Step does not make (the state of the random number generator or the tick period) is
+ * kept when the game is resumed. The snapshot is written to the slot that does not hold the newest
+ * complete snapshot, and the other slot is then emptied, since it can hold the same tick number.
+ *
+ * It waits for the EEPROM, so it is called while the game is paused.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Save_State_Checkpoint(void);
+
+/**
+ * @brief The Save_State_End function empties both snapshot slots when the game is over, so it
+ * cannot be resumed.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Save_State_End(void);
+
+/**
+ * @brief The Save_State_Resume function loads the saved game and applies its journal, then
+ * continues saving it.
+ *
+ * @param None
+ *
+ * @return True if a saved game was resumed; false if there is no saved game.
+ */
+bool Save_State_Resume(void);
+#endif
@@ -0,0 +1,72 @@
+/**
+ * @file Status_LEDs.c
+ *
+ * @brief Source code for the Status_LEDs driver.
+ *
+ * This file contains the function definitions for the Status_LEDs driver.
+ * More information about the meaning of the LEDs is on the header code of the Status_LEDs driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Status_LEDs.h"
+#include "GPIO.h"
+
+static uint8_t shown_rgb = 0x00;
+static uint8_t shown_bar = 0x00;
+
+void Status_LEDs_Init(void)
+{
+	RGB_LED_Init();
+	EduBase_LEDs_Init();
+	shown_rgb = RGB_LED_OFF;
+	shown_bar = EDUBASE_LED_ALL_OFF;
+}
+
+void Status_LEDs_Update(uint32_t work_cycles, uint32_t period_cycles)
+{
+	uint8_t rgb;
+	uint8_t bar;
+	
+	// The work is compared in quarters of the tick period to avoid a division.
+	// One EduBase LED is lit for each started quarter of the tick period.
+	uint32_t quarter = period_cycles / 4;
+	
+	if (work_cycles < quarter)
+	{
+		rgb = RGB_LED_GREEN;
+		bar = 0x01;
+	}
+	else if (work_cycles < 2 * quarter)
+	{
+		rgb = RGB_LED_GREEN;
+		bar = 0x03;
+	}
+	else if (work_cycles < 3 * quarter)
+	{
+		rgb = RGB_LED_GREEN;
+		bar = 0x07;
+	}
+	else if (work_cycles < period_cycles)
+	{
+		rgb = RGB_LED_BLUE;
+		bar = EDUBASE_LED_ALL_ON;
+	}
+	else
+	{
+		rgb = RGB_LED_RED;
+		bar = EDUBASE_LED_ALL_ON;
+	}
+	
+	if (rgb != shown_rgb)
+	{
+		RGB_LED_Output(rgb);
+		shown_rgb = rgb;
+	}
+	
+	if (bar != shown_bar)
+	{
+		EduBase_LEDs_Output(bar);
+		shown_bar = bar;
+	}
+}
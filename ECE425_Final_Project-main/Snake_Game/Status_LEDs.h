@@ -0,0 +1,39 @@
+/**
+ * @file Status_LEDs.h
+ *
+ * @brief Header code for the Status_LEDs driver.
+ *
+ * This file contains the function definitions for the Status_LEDs driver.
+ * The Status_LEDs driver shows the performance of the game on a running board:
+ *  - RGB LED: green when a tick's work (input, logic, and render) uses less than 75% of the
+ *    tick period, blue when it uses 75% to 100%, and red when it overruns the tick period.
+ *  - EduBase LEDs: a bar graph of the CPU load, where each LED (LED0 - LED3) is 25% of the tick.
+ *
+ * The LEDs are only written when their value changes, so an update usually costs a few compares.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef status_leds_header
+#define status_leds_header
+#include <stdint.h>
+
+/**
+ * @brief The Status_LEDs_Init function initializes the RGB LED and the EduBase LEDs and turns them off.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Status_LEDs_Init(void);
+
+/**
+ * @brief The Status_LEDs_Update function updates the LEDs with the timing of the last tick.
+ *
+ * @param work_cycles Number of cycles spent on the input, logic, and render phases of the tick.
+ * @param period_cycles Number of cycles in the tick period.
+ *
+ * @return None
+ */
+void Status_LEDs_Update(uint32_t work_cycles, uint32_t period_cycles);
+#endif
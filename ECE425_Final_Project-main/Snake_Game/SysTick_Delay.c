@@ -17,13 +17,14 @@
 #include "SysTick_Delay.h"
 
 // Global variable used to keep track of elapsed time in microseconds
-static uint32_t us_elapsed = 0;
+// It is volatile since SysTick_Handler changes it while the delay functions wait on it
+static volatile uint32_t us_elapsed = 0;
 
 // Global variable used to keep track of elapsed time in milliseconds
-static uint32_t ms_elapsed = 0;
+static volatile uint32_t ms_elapsed = 0;
 
 // Global flag used to indicate if milliseconds delay is active
-static uint8_t ms_active = 0;
+static volatile uint8_t ms_active = 0;
 
 void SysTick_Delay_Init(void)
 {	
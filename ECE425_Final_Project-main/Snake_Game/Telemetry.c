@@ -0,0 +1,63 @@
+/**
+ * @file Telemetry.c
+ *
+ * @brief Source code for the Telemetry driver.
+ *
+ * This file contains the function definitions for the Telemetry driver.
+ * More information about the record layout is on the header code of the Telemetry driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Telemetry.h"
+#include "UART1.h"
+#include "Game_Logic.h"
+#include "Game_Display.h"
+#include "Profiler.h"
+#include "CRC16.h"
+#include "COBS.h"
+
+static uint8_t record[TELEMETRY_RECORD_SIZE];
+static uint8_t encoded[COBS_MAX_ENCODED(TELEMETRY_RECORD_SIZE) + 1];
+static uint16_t dropped_records = 0;
+
+static void Telemetry_Put(uint8_t index, uint32_t value, uint8_t size)
+{
+	for (uint8_t i = 0; i < size; i++)
+	{
+		record[index + i] = value & 0xFF;
+		value >>= 8;
+	}
+}
+
+void Telemetry_Init(void)
+{
+	UART1_Init();
+	dropped_records = 0;
+}
+
+void Telemetry_Send_Tick(uint32_t tick, uint32_t work_cycles)
+{
+	record[0] = TELEMETRY_RECORD_TICK;
+	Telemetry_Put(1, tick, 4);
+	Telemetry_Put(5, PROFILER_CYCLES(), 4);
+	record[9] = CELL_X(snake_head);
+	record[10] = CELL_Y(snake_head);
+	record[11] = current_direction;
+	Telemetry_Put(12, game_score, 2);
+	Telemetry_Put(14, Profiler_Cycles_To_us(work_cycles), 4);
+	Telemetry_Put(18, frame_bytes_sent, 2);
+	Telemetry_Put(20, UART1_TX_Backlog(), 2);
+	Telemetry_Put(22, dropped_records, 2);
+
+	uint16_t crc = CRC16_Update(CRC16_INITIAL, record, TELEMETRY_RECORD_SIZE - 2);
+	Telemetry_Put(TELEMETRY_RECORD_SIZE - 2, crc, 2);
+
+	uint16_t encoded_length = COBS_Encode(record, TELEMETRY_RECORD_SIZE, encoded);
+	encoded[encoded_length++] = 0x00;
+
+	if (!UART1_Write(encoded, encoded_length))
+	{
+		dropped_records++;
+	}
+}
@@ -0,0 +1,67 @@
+/**
+ * @file Telemetry.h
+ *
+ * @brief Header code for the Telemetry driver.
+ *
+ * This file contains the function definitions for the Telemetry driver.
+ * The Telemetry driver sends one binary record per game tick on UART1 (PC5, 115200 baud), so the
+ * game can be logged for offline analysis while UART0 is used by the terminal.
+ *
+ * Every record is built as follows (multi-byte fields are little-endian), then COBS-encoded and
+ * terminated by a 0x00 byte, like the messages of the Game_Protocol driver:
+ *
+ *  Byte(s)     Field
+ *  0           Record type (TELEMETRY_RECORD_TICK)
+ *  1 to 4      Tick number since the game started
+ *  5 to 8      Timestamp: DWT cycle count at the end of the tick (20 ns per cycle)
+ *  9, 10       Head x, head y
+ *  11          Direction (0 = UP, 1 = DOWN, 2 = LEFT, 3 = RIGHT)
+ *  12, 13      Score
+ *  14 to 17    Tick duration: time used by the input, logic, and render phases in us
+ *  18, 19      Bytes sent to the terminal for the frame of this tick
+ *  20, 21      TX backlog: bytes still waiting in the UART1 transmit buffer before this record
+ *  22, 23      Number of records dropped because the transmit buffer was full
+ *  24, 25      CRC-16/CCITT-FALSE of bytes 0 to 23, low byte first
+ *
+ * In a game with several snakes, the head and direction are those of the first snake, and the
+ * score is the total of all the snakes.
+ *
+ * A record is 28 bytes on the line, which takes about 2.4 ms at 115200 baud, so the line keeps up
+ * with the fastest tick that a difficulty curve can reach (DIFFICULTY_MINIMUM_PERIOD, 20 ms).
+ * The set speed command of the Debug_Console has the same floor. If the transmit buffer still
+ * fills, records are dropped and counted instead of slowing down the game.
+ *
+ * The telemetry_csv program in Host_Tools decodes the records into a CSV file.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef telemetry_header
+#define telemetry_header
+#include <stdint.h>
+
+#define TELEMETRY_RECORD_TICK 0x10
+
+// Size of a record with its CRC, before the COBS encoding
+#define TELEMETRY_RECORD_SIZE 26
+
+/**
+ * @brief The Telemetry_Init function initializes UART1 for the telemetry stream.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Telemetry_Init(void);
+
+/**
+ * @brief The Telemetry_Send_Tick function queues the record of one tick and returns without
+ * waiting for it to be sent.
+ *
+ * @param tick The tick number since the game started.
+ * @param work_cycles The cycles used by the input, logic, and render phases of the tick.
+ *
+ * @return None
+ */
+void Telemetry_Send_Tick(uint32_t tick, uint32_t work_cycles);
+#endif
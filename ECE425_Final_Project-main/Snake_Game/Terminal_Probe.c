@@ -0,0 +1,123 @@
+/**
+ * @file Terminal_Probe.c
+ *
+ * @brief Source code for the Terminal_Probe driver.
+ *
+ * This file contains the function definitions for the Terminal_Probe driver.
+ * More information about the queries is on the header code of the Terminal_Probe driver.
+ *
+ * @author Samira Cordero-Morales
+*/
+
+#include "Terminal_Probe.h"
+#include "Game_Display.h"
+#include "Profiler.h"
+#include "UART0.h"
+#include <string.h>
+#include <stdbool.h>
+
+#define PROBE_REPLY_SIZE 32
+
+static char reply[PROBE_REPLY_SIZE];
+
+static int Probe_Read_Reply(char final_character)
+{
+	int length = 0;
+	uint32_t start = PROFILER_CYCLES();
+
+	while ((PROFILER_CYCLES() - start) < (PROBE_TIMEOUT_MS * PROFILER_CYCLES_PER_MS))
+	{
+		if (UART0_Char_Available())
+		{
+			char character = UART0_Input_Character();
+			if (length < PROBE_REPLY_SIZE - 1)
+			{
+				reply[length++] = character;
+			}
+
+			if (character == final_character)
+			{
+				reply[length] = 0;
+				return length;
+			}
+		}
+	}
+
+	// Timed out before the final character of the reply was received
+	reply[length] = 0;
+	return 0;
+}
+
+static const char *Probe_Parse_Decimal(const char *pt, uint32_t *number)
+{
+	*number = 0;
+	while (*pt >= '0' && *pt <= '9')
+	{
+		*number = (10 * *number) + (*pt - '0');
+		pt++;
+	}
+	return pt;
+}
+
+static bool Probe_Cursor_Column(uint32_t *column)
+{
+	// The reply has the format ESC [ row ; column R
+	UART0_Output_String("\x1B[6n");
+	if (Probe_Read_Reply('R') == 0)
+	{
+		return false;
+	}
+
+	const char *pt = strchr(reply, '[');
+	if (pt == NULL)
+	{
+		return false;
+	}
+
+	uint32_t row;
+	pt = Probe_Parse_Decimal(pt + 1, &row);
+	if (*pt != ';')
+	{
+		return false;
+	}
+	pt = Probe_Parse_Decimal(pt + 1, column);
+	return *pt == 'R';
+}
+
+Render_Mode Terminal_Probe(void)
+{
+	uint32_t column;
+	display_capabilities = 0;
+
+	UART0_Output_Character(UART0_CR);
+	if (!Probe_Cursor_Column(&column))
+	{
+		// No reply to a Cursor Position Report, so the terminal is a dumb terminal
+		return RENDER_MODE_FULL_REDRAW;
+	}
+	display_capabilities |= DISPLAY_CAP_CURSOR;
+
+	// Print one '.' and repeat it three times; the cursor ends on column 5 if REP worked
+	UART0_Output_String(".\x1B[3b");
+	if (Probe_Cursor_Column(&column) && column == 5)
+	{
+		display_capabilities |= DISPLAY_CAP_REP;
+	}
+
+	// Erase the test characters
+	UART0_Output_Character(UART0_CR);
+	UART0_Output_String("\x1B[K");
+
+	// Every VT100-compatible terminal replies to Device Attributes, so the reply ends the wait
+	UART0_Output_String("\x1B[?2026$p\x1B[c");
+	if (Probe_Read_Reply('c') != 0)
+	{
+		const char *pt = strstr(reply, "?2026;");
+		if (pt != NULL && pt[6] >= '1' && pt[6] <= '3')
+		{
+			display_capabilities |= DISPLAY_CAP_SYNC;
+		}
+	}
+
+	return RENDER_MODE_CURSOR_DELTA;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file Terminal_Probe.h
+ *
+ * @brief Header code for the Terminal_Probe driver.
+ *
+ * This file contains the function definitions for the Terminal_Probe driver.
+ * The Terminal_Probe driver sends query sequences to the serial terminal at startup and
+ * uses the replies to pick the cheapest rendering strategy that the terminal supports.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef terminal_probe_header
+#define terminal_probe_header
+#include "Game_Display.h"
+
+// Time to wait for a reply before the terminal is assumed not to support a query
+#define PROBE_TIMEOUT_MS 100
+
+/**
+ * @brief The Terminal_Probe function detects the features of the serial terminal.
+ *
+ * The following queries are sent through UART0:
+ *  - Cursor Position Report (ESC [ 6 n): a reply means the cursor can be addressed.
+ *  - A '.' repeated with REP (ESC [ 3 b), followed by another Cursor Position Report:
+ *    REP is supported if the cursor moved four columns.
+ *  - DEC private mode report for mode 2026 (ESC [ ? 2 0 2 6 $ p), followed by
+ *    Primary Device Attributes (ESC [ c): synchronized output is supported if the mode
+ *    report arrives before the Device Attributes reply.
+ *
+ * Each reply is read with a timeout of PROBE_TIMEOUT_MS. A terminal that does not reply to
+ * anything is treated as a dumb terminal and gets the plain full redraw.
+ * The display_capabilities variable is updated with the detected DISPLAY_CAP_ flags.
+ *
+ * @param None
+ *
+ * @return The cheapest render mode supported by the terminal.
+ */
+Render_Mode Terminal_Probe(void);
+#endif
@@ -4,6 +4,8 @@
  * @brief Source code for the UART0 driver.
  *
  * This file contains the function definitions for the UART0 driver.
+ * The UART0 functions are the producer and UART0_Handler is the consumer of the transmit
+ * SPSC_Queue, so the transmit buffer is shared without disabling interrupts.
  *
  * @note For more information regarding the UART module, refer to the
  * Universal Asynchronous Receivers / Transmitters (UARTs) section
@@ -18,9 +20,38 @@
 #include "UART0.h"
 #include <string.h>
 #include "TM4C123GH6PM.h"
-#include "SysTick_Delay.h"
+#include "Input_Queue.h"
+#include "SPSC_Queue.h"
 #include <stdbool.h>
 
+SPSC_QUEUE_DEFINE(tx_queue, char, UART0_TX_BUFFER_SIZE);
+
+static void UART0_Fill_FIFO(void)
+{
+	// Move bytes from the transmit buffer to the transmit FIFO until one of them is full or empty
+	const char *data;
+	while ((UART0->FR & UART0_TRANSMIT_FIFO_FULL_BIT_MASK) == 0 && (data = SPSC_Queue_Peek(&tx_queue)) != 0)
+	{
+		UART0->DR = *data;
+		SPSC_Queue_Skip(&tx_queue);
+	}
+}
+
+static void UART0_Start_Transmit(void)
+{
+	/* While the transmit interrupt is unmasked, UART0_Handler also sends the new bytes. Otherwise the
+	transmitter is idle, and since the interrupt only fires when the FIFO level drops past the trigger
+	level, the FIFO is filled here first. The handler cannot run meanwhile, so only one of them consumes. */
+	if ((UART0->IM & UART0_TRANSMIT_INTERRUPT_BIT_MASK) == 0)
+	{
+		UART0_Fill_FIFO();
+		if (SPSC_Queue_Count(&tx_queue) != 0)
+		{
+			UART0->IM |= UART0_TRANSMIT_INTERRUPT_BIT_MASK;
+		}
+	}
+}
+
 void UART0_Init(void)
 {
 	// Enable the clock to the UART0 module by setting the R0 bit (Bit 0) in the RCGCUART register
@@ -76,6 +107,14 @@ void UART0_Init(void)
 	
 	// Enable the PA1 and PA0 functionality in the DEN register
 	GPIOA->DEN |= 0x03;
+	
+	// Interrupt when the Transmit FIFO drops to 1/8 full by clearing the TXIFLSEL field (Bits 2 to 0)
+	UART0->IFLS &= ~0x07;
+	
+	// The transmit interrupt is only unmasked while the transmit buffer has data
+	UART0->IM &= ~UART0_TRANSMIT_INTERRUPT_BIT_MASK;
+	NVIC_SetPriority(UART0_IRQn, INPUT_INTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(UART0_IRQn);
 }
 
 char UART0_Input_Character(void)
@@ -89,11 +128,10 @@ char UART0_Input_Character(void)
 
 void UART0_Output_Character(char data)
 {
-	// Wait until the UART transmit buffer is ready to accept a new character
-	while((UART0 -> FR & UART0_TRANSMIT_FIFO_FULL_BIT_MASK) != 0);
+	// Wait until the transmit buffer is ready to accept a new character
+	while (!SPSC_Queue_Push(&tx_queue, &data));
 	
-	// Write the specified character in the transmit buffer to the serial terminal
-	UART0->DR = data;
+	UART0_Start_Transmit();
 }
 
 void UART0_Input_String(char *buffer_pointer, uint16_t buffer_size) 
@@ -125,13 +163,26 @@ void UART0_Input_String(char *buffer_pointer, uint16_t buffer_size)
 
 void UART0_Output_String(char *pt)
 {
-	while(*pt)
+	UART0_Output_Buffer(pt, strlen(pt));
+}
+
+void UART0_Output_Buffer(const char *buffer, uint16_t length)
+{
+	// A block that does not fit is added in pieces while the handler makes room
+	while (length > 0)
 	{
-		UART0_Output_Character(*pt);
-		pt++;
+		uint32_t added = SPSC_Queue_Push_Bulk(&tx_queue, buffer, length);
+		buffer += added;
+		length -= added;
+		UART0_Start_Transmit();
 	}
 }
 
+uint16_t UART0_TX_High_Water(void)
+{
+	return SPSC_Queue_High_Water(&tx_queue);
+}
+
 uint32_t UART0_Input_Unsigned_Decimal(void)
 {
 	uint32_t number = 0;
@@ -252,4 +303,46 @@ void UART0_Output_Newline(void)
 bool UART0_Char_Available(void)
 {
 	return (UART0->FR & UART0_RECEIVE_FIFO_EMPTY_BIT_MASK) == 0;
-}
\ No newline at end of file
+}
+
+bool UART0_Transmit_Idle(void)
+{
+	return SPSC_Queue_Count(&tx_queue) == 0 && (UART0->FR & UART0_BUSY_BIT_MASK) == 0;
+}
+
+void UART0_Enable_Receive_Interrupt(void)
+{
+	// Interrupt when the Receive FIFO is 1/8 full by clearing the RXIFLSEL field (Bits 5 to 3)
+	UART0->IFLS &= ~0x38;
+	
+	// Clear any pending receive interrupts, then enable the RXIM (Bit 4) and RTIM (Bit 6) bits
+	UART0->ICR = UART0_RECEIVE_INTERRUPT_BIT_MASK | UART0_RECEIVE_TIMEOUT_INTERRUPT_BIT_MASK;
+	UART0->IM |= UART0_RECEIVE_INTERRUPT_BIT_MASK | UART0_RECEIVE_TIMEOUT_INTERRUPT_BIT_MASK;
+}
+
+void UART0_Handler(void)
+{
+	// Until UART0_Enable_Receive_Interrupt is called, the Receive FIFO is read directly instead
+	if (UART0->IM & UART0_RECEIVE_INTERRUPT_BIT_MASK)
+	{
+		// Clear the receive interrupts before reading so that a new character raises them again
+		UART0->ICR = UART0_RECEIVE_INTERRUPT_BIT_MASK | UART0_RECEIVE_TIMEOUT_INTERRUPT_BIT_MASK;
+		
+		while ((UART0->FR & UART0_RECEIVE_FIFO_EMPTY_BIT_MASK) == 0)
+		{
+			Input_Queue_Push((char)(UART0->DR & 0xFF), INPUT_SOURCE_UART);
+		}
+	}
+	
+	if (UART0->IM & UART0_TRANSMIT_INTERRUPT_BIT_MASK)
+	{
+		UART0->ICR = UART0_TRANSMIT_INTERRUPT_BIT_MASK;
+		UART0_Fill_FIFO();
+		
+		// Nothing is left to send, so the interrupt is masked until the next write
+		if (SPSC_Queue_Count(&tx_queue) == 0)
+		{
+			UART0->IM &= ~UART0_TRANSMIT_INTERRUPT_BIT_MASK;
+		}
+	}
+}
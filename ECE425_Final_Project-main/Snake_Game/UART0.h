@@ -20,6 +20,13 @@
 
 #define UART0_RECEIVE_FIFO_EMPTY_BIT_MASK 0x10
 #define UART0_TRANSMIT_FIFO_FULL_BIT_MASK 0x20
+#define UART0_BUSY_BIT_MASK 0x08
+#define UART0_RECEIVE_INTERRUPT_BIT_MASK 0x10
+#define UART0_RECEIVE_TIMEOUT_INTERRUPT_BIT_MASK 0x40
+#define UART0_TRANSMIT_INTERRUPT_BIT_MASK 0x20
+
+// Size of the transmit buffer in bytes; it must be a power of two
+#define UART0_TX_BUFFER_SIZE 1024
 
 /**
  * @brief Carriage return character
@@ -60,6 +67,10 @@
  *
  * @note The PA1 (TX) and PA0 (RX) pins are used for UART communication via USB.
  *
+ * The transmitter is interrupt-driven: the output functions copy the characters into a transmit
+ * buffer of UART0_TX_BUFFER_SIZE bytes and return, and UART0_Handler moves them into the Transmit
+ * FIFO. The output functions only wait when the transmit buffer is full.
+ *
  * @return None
  */
 void UART0_Init(void);
@@ -79,8 +90,8 @@ char UART0_Input_Character(void);
 /**
  * @brief The UART0_Output_Character function transmits a character via UART to the serial terminal.
  *
- * This function waits until the UART transmit buffer is ready to accept
- * a new character and then writes the specified character in the transmit buffer to the serial terminal.
+ * This function waits until the transmit buffer is ready to accept a new character
+ * and then adds the specified character to it.
  *
  * @param data The character to be transmitted to the serial terminal.
  *
@@ -115,6 +126,29 @@ void UART0_Input_String(char *buffer_pointer, uint16_t buffer_size);
  */
 void UART0_Output_String(char *pt);
 
+/**
+ * @brief The UART0_Output_Buffer function transmits a block of bytes via UART to the serial terminal.
+ *
+ * Unlike UART0_Output_String, the block may contain null characters, so its length is given.
+ * The block is copied into the transmit buffer with at most two copies per piece.
+ *
+ * @param buffer Pointer to the bytes to be transmitted.
+ * @param length Number of bytes to be transmitted.
+ *
+ * @return None
+ */
+void UART0_Output_Buffer(const char *buffer, uint16_t length);
+
+/**
+ * @brief The UART0_TX_High_Water function returns the largest number of bytes that were waiting
+ * in the transmit buffer at once since startup.
+ *
+ * @param None
+ *
+ * @return The high-water mark, up to UART0_TX_BUFFER_SIZE.
+ */
+uint16_t UART0_TX_High_Water(void);
+
 /**
  * @brief The UART0_Input_Unsigned_Decimal function reads an unsigned decimal number from the UART receive buffer.
  *
@@ -184,4 +218,41 @@ void UART0_Output_Newline(void);
  *
  * @return False if the Receive FIFO is full; true if the Receive FIFO is empty.
  */
-bool UART0_Char_Available(void);
\ No newline at end of file
+bool UART0_Char_Available(void);
+
+/**
+ * @brief The UART0_Transmit_Idle function checks if every byte that was output has been sent:
+ * the transmit buffer and the Transmit FIFO are empty, and the last stop bit is sent (BUSY is clear).
+ *
+ * @param None
+ *
+ * @return True if the transmitter is idle; false otherwise.
+ */
+bool UART0_Transmit_Idle(void);
+
+/**
+ * @brief The UART0_Enable_Receive_Interrupt function makes UART0 push every received character
+ * into the Input_Queue instead of leaving it in the Receive FIFO.
+ *
+ * The receive interrupt (RXIM) and the receive timeout interrupt (RTIM) are both enabled, so a
+ * single character is delivered after 32 bit periods without waiting for the FIFO to fill.
+ * After this function is called, UART0_Char_Available and UART0_Input_Character must not be used;
+ * the characters are read with Input_Queue_Pop instead.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void UART0_Enable_Receive_Interrupt(void);
+
+/**
+ * @brief The UART0_Handler function is the interrupt service routine for UART0.
+ *
+ * It moves every character in the Receive FIFO into the Input_Queue, once the receive interrupt
+ * is enabled, and refills the Transmit FIFO from the transmit buffer.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void UART0_Handler(void);
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @file UART1.c
+ *
+ * @brief Source code for the UART1 driver.
+ *
+ * This file contains the function definitions for the UART1 driver.
+ * UART1_Write is the producer and UART1_Handler is the consumer of the transmit SPSC_Queue, so the
+ * transmit buffer is shared without disabling interrupts.
+ *
+ * @note For more information regarding the UART module, refer to the
+ * Universal Asynchronous Receivers / Transmitters (UARTs) section
+ * of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @note Assumes that the frequency of the system clock is 50 MHz.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#include "UART1.h"
+#include "SPSC_Queue.h"
+
+SPSC_QUEUE_DEFINE(tx_queue, uint8_t, UART1_TX_BUFFER_SIZE);
+
+static void UART1_Fill_FIFO(void)
+{
+	// Move bytes from the transmit buffer to the transmit FIFO until one of them is full or empty
+	const uint8_t *data;
+	while ((UART1->FR & UART1_TRANSMIT_FIFO_FULL_BIT_MASK) == 0 && (data = SPSC_Queue_Peek(&tx_queue)) != 0)
+	{
+		UART1->DR = *data;
+		SPSC_Queue_Skip(&tx_queue);
+	}
+}
+
+void UART1_Init(void)
+{
+	// Enable the clock to the UART1 module by setting the R1 bit (Bit 1) in the RCGCUART register
+	SYSCTL->RCGCUART |= 0x02;
+	
+	// Enable the clock to Port C by setting the R2 bit (Bit 2) in the RCGCGPIO register
+	SYSCTL->RCGCGPIO |= 0x04;
+	
+	// Disable the UART1 module before the configuration by clearing the UARTEN bit (Bit 0)
+	UART1->CTL &= ~0x0001;
+	
+	// Use the system clock divided by 16 by clearing the HSE bit (Bit 5)
+	UART1->CTL &= ~0x0020;
+	
+	// Set the baud rate to 115200 (see UART0_Init for the calculation): IBRD = 27, FBRD = 8
+	UART1->IBRD = 27;
+	UART1->FBRD = 8;
+	
+	// 8 data bits (WLEN, Bits 6 to 5), FIFOs enabled (FEN, Bit 4), one stop bit, and no parity
+	UART1->LCRH = 0x70;
+	
+	// Interrupt when the transmit FIFO drops to 1/8 full by clearing the TXIFLSEL field (Bits 2 to 0)
+	UART1->IFLS &= ~0x07;
+	
+	// Enable the UART1 module and its transmitter by setting the UARTEN (Bit 0) and TXE (Bit 8) bits
+	UART1->CTL |= 0x0101;
+	
+	// Configure PC5 as the U1TX pin: AFSEL, the PMC5 field (Bits 23 to 20) of PCTL, and DEN
+	GPIOC->AFSEL |= 0x20;
+	GPIOC->PCTL &= ~0x00F00000;
+	GPIOC->PCTL |= 0x00200000;
+	GPIOC->DEN |= 0x20;
+	
+	// The transmit interrupt is only unmasked while the transmit buffer has data
+	UART1->IM &= ~UART1_TRANSMIT_INTERRUPT_BIT_MASK;
+	NVIC_SetPriority(UART1_IRQn, UART1_INTERRUPT_PRIORITY);
+	NVIC_EnableIRQ(UART1_IRQn);
+}
+
+bool UART1_Write(const uint8_t *data, uint16_t length)
+{
+	// Only the handler can free more room meanwhile, so the block is sure to fit
+	if (length > SPSC_Queue_Free(&tx_queue))
+	{
+		return false;
+	}
+	SPSC_Queue_Push_Bulk(&tx_queue, data, length);
+
+	/* While the transmit interrupt is unmasked, UART1_Handler also sends the new bytes. Otherwise the
+	transmitter is idle, and since the interrupt only fires when the FIFO level drops past the trigger
+	level, the FIFO is filled here first. The handler cannot run meanwhile, so only one of them consumes. */
+	if ((UART1->IM & UART1_TRANSMIT_INTERRUPT_BIT_MASK) == 0)
+	{
+		UART1_Fill_FIFO();
+		if (SPSC_Queue_Count(&tx_queue) != 0)
+		{
+			UART1->IM |= UART1_TRANSMIT_INTERRUPT_BIT_MASK;
+		}
+	}
+	return true;
+}
+
+uint16_t UART1_TX_Backlog(void)
+{
+	return SPSC_Queue_Count(&tx_queue);
+}
+
+uint16_t UART1_TX_High_Water(void)
+{
+	return SPSC_Queue_High_Water(&tx_queue);
+}
+
+void UART1_Handler(void)
+{
+	UART1->ICR = UART1_TRANSMIT_INTERRUPT_BIT_MASK;
+	UART1_Fill_FIFO();
+
+	// Nothing is left to send, so the interrupt is masked until the next write
+	if (SPSC_Queue_Count(&tx_queue) == 0)
+	{
+		UART1->IM &= ~UART1_TRANSMIT_INTERRUPT_BIT_MASK;
+	}
+}
@@ -0,0 +1,87 @@
+/**
+ * @file UART1.h
+ *
+ * @brief Header file for the UART1 driver.
+ *
+ * This file contains the function definitions for the UART1 driver.
+ * UART1 only transmits. Data is copied into a RAM buffer and sent by the UART1 transmit interrupt,
+ * so a write never waits for the serial line.
+ *
+ * @note For more information regarding the UART module, refer to the
+ * Universal Asynchronous Receivers / Transmitters (UARTs) section
+ * of the TM4C123GH6PM Microcontroller Datasheet.
+ *   - Link: https://www.ti.com/lit/gpn/TM4C123GH6PM
+ *
+ * @note Assume that the frequency of the system clock is 50 MHz.
+ *
+ * @author Samira Cordero-Morales
+ */
+
+#ifndef uart1_header
+#define uart1_header
+#include "TM4C123GH6PM.h"
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UART1_TRANSMIT_FIFO_FULL_BIT_MASK 0x20
+#define UART1_TRANSMIT_INTERRUPT_BIT_MASK 0x20
+
+// Size of the transmit buffer in bytes; it must be a power of two
+#define UART1_TX_BUFFER_SIZE 256
+
+// Lower priority than the input interrupts, so a key press is never delayed by the transmitter
+#define UART1_INTERRUPT_PRIORITY 5
+
+/**
+ * @brief The UART1_Init function initializes the UART1 module and its transmit interrupt.
+ *
+ * This function configures the UART1 module with the following configuration:
+ *
+ * - Parity: Disabled
+ * - Bit Order: Least Significant Bit (LSB) first
+ * - Character Length: 8 data bits
+ * - Stop Bits: 1
+ * - UART Clock Source: System Clock (50 MHz) Divided By 16
+ * - Baud Rate: 115200
+ *
+ * @note The PC5 (TX) pin is used, since Port B is used by the EduBase LEDs and the trace pins.
+ * PC4 (RX) is not used.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void UART1_Init(void);
+
+/**
+ * @brief The UART1_Write function adds a block of bytes to the transmit buffer and returns
+ * without waiting for them to be sent.
+ *
+ * The block is either added whole or not at all, so a message is never cut in the middle.
+ *
+ * @param data The bytes to send.
+ * @param length The number of bytes.
+ *
+ * @return True if the block was added; false if the transmit buffer did not have enough room.
+ */
+bool UART1_Write(const uint8_t *data, uint16_t length);
+
+/**
+ * @brief The UART1_TX_Backlog function returns the number of bytes waiting in the transmit buffer.
+ *
+ * @param None
+ *
+ * @return The number of bytes that are not sent yet.
+ */
+uint16_t UART1_TX_Backlog(void);
+
+/**
+ * @brief The UART1_TX_High_Water function returns the largest number of bytes that were waiting
+ * in the transmit buffer at once since startup.
+ *
+ * @param None
+ *
+ * @return The high-water mark, up to UART1_TX_BUFFER_SIZE.
+ */
+uint16_t UART1_TX_High_Water(void);
+#endif
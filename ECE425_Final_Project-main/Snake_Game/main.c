@@ -7,6 +7,16 @@
  * It interfaces with the Tiva C Series TM4C123G LaunchPad and provides a display of a snake game
  * on the Tera Term terminal.
  *
+ * The game ticks are signaled by the Game_Timer driver, and the other screens use a state timer.
+ *
+ * The program is a state machine with one state per screen: the title screen, the demo game
+ * of the attract mode, the game, the game with several snakes, the game over screen, and the play again prompt. The main loop calls the handler of the current
+ * state, and each handler only acts on an input event or on the expiry of the state timer,
+ * then returns right away. The loop itself does the background work (such as saving the
+ * high score table) between the handlers, so nothing waits in a busy loop. When no handler
+ * has anything to do, the loop puts the core to sleep until the next interrupt (see the
+ * Low_Power driver), and the share of the time spent asleep is reported after each game.
+ *
  * @note For more information regarding the UART module, refer to the
  * Universal Asynchronous Receivers / Transmitters (UARTs) section
  * of the TM4C123GH6PM Microcontroller Datasheet.
@@ -16,165 +26,806 @@
 */
 
 #include "TM4C123GH6PM.h"
-#include "SysTick_Delay.h"
 #include "UART0.h"
 #include "Game_Display.h"
 #include "Game_Logic.h"
 #include "Game_Replay.h"
+#include "Game_Protocol.h"
+#include "Terminal_Probe.h"
+#include "Profiler.h"
+#include "Input_Queue.h"
+#include "GPIO.h"
+#include "Phase_Trace.h"
+#include "Status_LEDs.h"
+#include "Game_Stress_Test.h"
+#include "High_Scores.h"
+#include "Save_State.h"
+#include "Telemetry.h"
+#include "Debug_Console.h"
+#include "Event_Trace.h"
+#include "Attract_Mode.h"
+#include "Game_Timer.h"
+#include "Difficulty.h"
+#include "Low_Power.h"
+#include "Multi_Snake.h"
+#include "Level_Pack.h"
+#include "Boot_Profile.h"
 #include <stdbool.h>
 
-int main(void)
+// Keys that are typed while the snake crashes are dropped for this long, so they cannot answer the prompt
+#define GAME_OVER_HOLD_MS 1000
+
+typedef enum
 {
-	SysTick_Delay_Init();
-	UART0_Init();
+	STATE_TITLE,
+	STATE_ATTRACT,
+	STATE_GAME,
+	STATE_MULTI_GAME,
+	STATE_GAME_OVER,
+	STATE_PLAY_AGAIN,
+	STATE_EXIT
+} Game_State;
+
+static Render_Mode terminal_render_mode;
+static bool resume_game = false;
+static uint32_t game_tick = 0;
+
+// Number of snakes and players of the next game with several snakes
+static uint8_t multi_game_snakes;
+static uint8_t multi_game_players;
+
+// The state timer is a deadline on the DWT cycle counter, so it needs no interrupt. The counter is
+// read through Low_Power_Cycles, which adds the time asleep that the counter may not count.
+static uint32_t timer_deadline;
+static bool timer_running = false;
+
+static void Timer_Start(uint32_t delay_ms)
+{
+	timer_deadline = Low_Power_Cycles() + (delay_ms * PROFILER_CYCLES_PER_MS);
+	timer_running = true;
+}
+
+// Cycles left until the deadline, or 0 once it is due
+static uint32_t Timer_Remaining_Cycles(void)
+{
+	// The difference is signed so that the deadline is still found when the counter wraps around
+	int32_t remaining_cycles = (int32_t)(timer_deadline - Low_Power_Cycles());
+	return (remaining_cycles > 0) ? remaining_cycles : 0;
+}
+
+static bool Timer_Expired(void)
+{
+	if (timer_running && Timer_Remaining_Cycles() == 0)
+	{
+		timer_running = false;
+		return true;
+	}
+	return false;
+}
+
+// Starts the game ticks, the first one right away; the delay phase ends when a tick begins
+static void Game_Start_Ticks(void)
+{
+	PHASE_TRACE_BEGIN(PHASE_TRACE_DELAY);
+	Game_Timer_Start(Difficulty_Tick_Cycles(snake_period));
+}
+
+// The EduBase buttons SW2, SW3, SW4, and SW5 act as the A, S, W, and D keys
+static char Input_Key(const Input_Event *event)
+{
+	if (event->source != INPUT_SOURCE_BUTTON)
+	{
+		return event->key;
+	}
 	
-	while(1) // Outer while loop for replayability
+	switch (event->key)
 	{
-		UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
-		UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
-		UART0_Output_String("UART Snake Game");
+		case 0x08:
+		{
+			return 'a';
+		}
+		case 0x04:
+		{
+			return 's';
+		}
+		case 0x02:
+		{
+			return 'w';
+		}
+		case 0x01:
+		{
+			return 'd';
+		}
+		default:
+		{
+			return 0;
+		}
+	}
+}
+
+// The demo game starts if no key is pressed for a while, when the terminal can show it cheaply
+static void Title_Screen_Wait(void)
+{
+	if (terminal_render_mode == RENDER_MODE_CURSOR_DELTA)
+	{
+		Timer_Start(ATTRACT_MODE_IDLE_MS);
+	}
+}
+
+static void Title_Screen_Enter(void)
+{
+	UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
+	UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
+	UART0_Output_String("UART Snake Game");
+	UART0_Output_Newline();
+	UART0_Output_String("Use W, A, S, and D keys to control the moving snake.");
+	UART0_Output_Newline();
+	UART0_Output_String("The snake moves faster as you score! Can you fill the whole board?!");
+	UART0_Output_Newline();
+	UART0_Output_String("Press B instead to stream binary frames to a host renderer.");
+	UART0_Output_Newline();
+	UART0_Output_String("Press X to run the full-board stress test.");
+	UART0_Output_Newline();
+	UART0_Output_String("Press M for a two-player game (player 2 uses I, J, K, and L), or N to play against the computer.");
+	UART0_Output_Newline();
+	UART0_Output_String("Press R to resume a saved game, or Q during a game to suspend it.");
+	UART0_Output_Newline();
+	UART0_Output_String("Press L to change the level. Level: ");
+	UART0_Output_String((char *)levels[level_selected].name);
+	UART0_Output_Newline();
+	UART0_Output_String("Press E to change the edges. Edges: ");
+	UART0_Output_String(board_wrap ? "wrap around" : "walls");
+	UART0_Output_Newline();
+	UART0_Output_String("Press the SPACEBAR to start the Snake Game! ");
+	resume_game = false;
+	Multi_Snake_End();
+	Title_Screen_Wait();
+}
+
+static Game_State Title_Screen_Update(void)
+{
+	Input_Event event;
+	if (!Input_Queue_Pop(&event))
+	{
+		return Timer_Expired() ? STATE_ATTRACT : STATE_TITLE;
+	}
+	Title_Screen_Wait();
+	if (event.source != INPUT_SOURCE_UART)
+	{
+		return STATE_TITLE;
+	}
+	
+	char start_game = event.key;
+	if (start_game == ' ')
+	{
+		render_mode = terminal_render_mode;
+		return STATE_GAME; // Start Snake Game
+	}
+	else if (start_game == 'B' || start_game == 'b')
+	{
+		render_mode = RENDER_MODE_BINARY;
+		return STATE_GAME; // Start Snake Game in binary output mode
+	}
+	else if (start_game == 'R' || start_game == 'r')
+	{
+		resume_game = Save_State_Resume();
+		if (resume_game)
+		{
+			render_mode = terminal_render_mode;
+			return STATE_GAME; // Continue the saved game
+		}
 		UART0_Output_Newline();
-		UART0_Output_String("Use W, A, S, and D keys to control the moving snake.");
+		UART0_Output_String("There is no saved game. Press the SPACEBAR to start the Snake Game! ");
+	}
+	else if (start_game == 'M' || start_game == 'm')
+	{
+		multi_game_snakes = 2;
+		multi_game_players = 2;
+		render_mode = terminal_render_mode;
+		return STATE_MULTI_GAME; // Start a game of two players
+	}
+	else if (start_game == 'N' || start_game == 'n')
+	{
+		multi_game_snakes = MULTI_SNAKE_MAX;
+		multi_game_players = 1;
+		render_mode = terminal_render_mode;
+		return STATE_MULTI_GAME; // Start a game against the computer
+	}
+	else if (start_game == 'L' || start_game == 'l')
+	{
+		level_selected = (level_selected + 1) % LEVEL_COUNT;
 		UART0_Output_Newline();
-		UART0_Output_String("For every 10 points, the snake moves faster! Can you reach 50 points?!");
+		UART0_Output_String("Level: ");
+		UART0_Output_String((char *)levels[level_selected].name);
 		UART0_Output_Newline();
 		UART0_Output_String("Press the SPACEBAR to start the Snake Game! ");
-		
-		while(1) // Inner while loop to start the game
+	}
+	else if (start_game == 'E' || start_game == 'e')
+	{
+		board_wrap = !board_wrap;
+		UART0_Output_Newline();
+		UART0_Output_String("Edges: ");
+		UART0_Output_String(board_wrap ? "wrap around" : "walls");
+		UART0_Output_Newline();
+		UART0_Output_String("Press the SPACEBAR to start the Snake Game! ");
+	}
+	else if (start_game == 'X' || start_game == 'x')
+	{
+		UART0_Output_Newline();
+		Game_Stress_Test();
+		UART0_Output_String("Press the SPACEBAR to start the Snake Game! ");
+	}
+	return STATE_TITLE;
+}
+
+static Game_State Attract_Mode_Update(void)
+{
+	// Any key or button stops the demo and is not used for anything else
+	Input_Event event;
+	if (Input_Queue_Pop(&event))
+	{
+		return STATE_TITLE;
+	}
+	
+	if (Timer_Expired())
+	{
+		if (!Attract_Mode_Tick())
+		{
+			return STATE_TITLE;
+		}
+		Timer_Start(ATTRACT_MODE_TICK_MS);
+	}
+	return STATE_ATTRACT;
+}
+
+static void Game_Screen_Enter(void)
+{
+	UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
+	UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
+	
+	// A resumed game is already rebuilt by Save_State_Resume, and is drawn by the first full redraw
+	if (!resume_game)
+	{
+		Game_Init();
+		Save_State_Begin();
+	}
+	Display_Reset();
+	Input_Queue_Init();
+	game_tick = 0;
+	Low_Power_Reset_Stats();
+	EVENT_TRACE(EVENT_TRACE_GAME_START, 0, snake_head);
+	
+	Game_Start_Ticks();
+}
+
+// Shows how much of the tick period the input, logic, and render phases used, and records the
+// tick in the telemetry, the event trace, and the stats of the console
+static void Record_Tick_Work(uint32_t tick_start_cycles)
+{
+	uint32_t tick_work_cycles = PROFILER_CYCLES() - tick_start_cycles;
+	uint32_t tick_period_cycles = (snake_period / DIFFICULTY_US(1)) * PROFILER_CYCLES_PER_US;
+	Status_LEDs_Update(tick_work_cycles, tick_period_cycles);
+	if (tick_work_cycles > tick_period_cycles)
+	{
+		uint32_t work_10us = Profiler_Cycles_To_us(tick_work_cycles) / 10;
+		EVENT_TRACE(EVENT_TRACE_OVERRUN, 0, (work_10us > 0xFFFF) ? 0xFFFF : work_10us);
+	}
+	Telemetry_Send_Tick(game_tick, tick_work_cycles);
+	Debug_Console_Record_Tick(tick_work_cycles);
+	game_tick++;
+}
+
+static Game_State Game_Screen_Update(void)
+{
+	// While the console is open, the game is paused and the keyboard is read by the console
+	if (Debug_Console_Active())
+	{
+		Input_Event console_event;
+		if (Input_Queue_Pop(&console_event) && console_event.source == INPUT_SOURCE_UART)
 		{
-			if (UART0_Char_Available())
+			Debug_Console_Key(console_event.key);
+			
+			// The console wrote over the screen, so the game is redrawn when it closes
+			if (!Debug_Console_Active())
 			{
-				char start_game = UART0_Input_Character();
-				if (start_game == ' ')
-				{
-					break; // Start Snake Game
-				}
+				Display_Reset();
+				Game_Start_Ticks();
 			}
 		}
+		return STATE_GAME;
+	}
+	
+	// Keys stay in the Input_Queue until the next tick, which applies at most one of them
+	if (!Game_Timer_Take_Tick())
+	{
+		return STATE_GAME;
+	}
+	PHASE_TRACE_END(PHASE_TRACE_DELAY);
+	
+	uint32_t tick_start_cycles = PROFILER_CYCLES();
+	PHASE_TRACE_BEGIN(PHASE_TRACE_INPUT);
+	Input_Event event;
+	bool suspend_game = false;
+	if (Input_Queue_Pop(&event))
+	{
+		char input = Input_Key(&event);
+		bool direction_key = true;
+		Direction previous_direction = current_direction;
+		Event_Trace_Record(event.timestamp, EVENT_TRACE_KEY, event.key, event.source);
 		
-		UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
-		UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
-		Game_Init();
-		uint32_t snake_delay_ms = 200;
-		
-		while(1) // Inner while loop for playing one game
+		switch (input)
 		{
-			if (UART0_Char_Available())
+			case 'W':
+			case 'w':
 			{
-				char input = UART0_Input_Character();
-				switch (input)
+				if (current_direction != DOWN)
 				{
-					case 'W':
-					case 'w':
-					{
-						if (current_direction != DOWN)
-						{
-							current_direction = UP;						
-						}
-						break;
-					}
-					case 'S':
-					case 's':
-					{
-						if (current_direction != UP)
-						{
-							current_direction = DOWN;
-						}
-						break;
-					}
-					case 'A':
-					case 'a':
-					{
-						if (current_direction != RIGHT)
-						{
-							current_direction = LEFT;
-						}
-						break;
-					}
-					case 'D':
-					case 'd':
-					{
-						if (current_direction != LEFT)
-						{
-							current_direction = RIGHT;
-						}
-						break;
-					}
+					current_direction = UP;
 				}
+				break;
 			}
-				
-			Snake_Move();
-				
-			// If the snake catches the food
-			if (snake[0].x == food.x && snake[0].y == food.y)
+			case 'S':
+			case 's':
 			{
-				Snake_Grow();
-				Food_Init();
-					
-				// For every 10 points, increase snake's speed
-				snake_delay_ms = 200 - (game_score / 10) * 40;
-				if (snake_delay_ms < 40)
+				if (current_direction != UP)
 				{
-					snake_delay_ms = 40;
+					current_direction = DOWN;
 				}
+				break;
 			}
-			
-			if (Check_Collision())
+			case 'A':
+			case 'a':
 			{
-				UART0_Output_String("\nGAME OVER! Collision hit!");
-				UART0_Output_Newline();
-				UART0_Output_String("Your final score is ");
-				UART0_Output_Unsigned_Decimal(game_score);
-				UART0_Output_String(" points.");
-				UART0_Output_Newline();
-				break; // Exit inner while loop
+				if (current_direction != RIGHT)
+				{
+					current_direction = LEFT;
+				}
+				break;
 			}
-				
-			// When the user reaches 50 points
-			if (game_score >= 50)
+			case 'D':
+			case 'd':
 			{
-				UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
-				UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
-				
-				UART0_Output_Newline();				
-				UART0_Output_String("CONGRATULATIONS! You won the UART Snake Game!");
-				UART0_Output_Newline();
-				UART0_Output_String("Final Score: ");
-				UART0_Output_Unsigned_Decimal(game_score);
-				UART0_Output_Newline();
-				break; // Exit inner while loop
+				if (current_direction != LEFT)
+				{
+					current_direction = RIGHT;
+				}
+				break;
 			}
-			
-			// Game display
-			UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
-			UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
-				
-			UART0_Output_String("UART Snake Game");
-			UART0_Output_Newline();
-			UART0_Output_String("Use W, A, S, and D keys to control the moving snake.");
-			UART0_Output_Newline();
-			UART0_Output_String("For every 10 points, the snake moves faster! Can you reach 50 points?!");
-			UART0_Output_Newline();
-			UART0_Output_Newline();
-			
-			UART0_Output_String("Game Score: ");
-			UART0_Output_Unsigned_Decimal(game_score);
-			UART0_Output_Newline();
-			UART0_Output_String("Delay Speed: ");
-			UART0_Output_Unsigned_Decimal(snake_delay_ms);
-			UART0_Output_String(" ms");
-				
-			Draw_Game();
-			SysTick_Delay1ms(snake_delay_ms);
+			case UART0_ESC:
+			{
+				Debug_Console_Open();
+				direction_key = false;
+				break;
+			}
+			case 'Q':
+			case 'q':
+			{
+				suspend_game = true;
+				direction_key = false;
+				break;
+			}
+			default:
+			{
+				direction_key = false;
+				break;
+			}
+		}
+		
+		if (direction_key)
+		{
+			Input_Record_Latency(&event);
 		}
 		
-		// After winnning or losing the game,
-		if (!Play_Again())
+		if (current_direction != previous_direction)
+		{
+			EVENT_TRACE(EVENT_TRACE_DIRECTION, current_direction, snake_head);
+		}
+	}
+	PHASE_TRACE_END(PHASE_TRACE_INPUT);
+	
+	// Every tick is journaled, and the main loop finishes the words that wait for the EEPROM, so the
+	// game is suspended by leaving it as it is
+	if (suspend_game)
+	{
+		Game_Timer_Stop();
+		Display_Move_Below_Board();
+		UART0_Output_String("\nGame suspended. Press R on the title screen to resume it, even after a reset.");
+		UART0_Output_Newline();
+		return STATE_PLAY_AGAIN;
+	}
+	
+	// The tick ends here when the console was opened, and the ticks start again when it closes
+	if (Debug_Console_Active())
+	{
+		Game_Timer_Stop();
+		return STATE_GAME;
+	}
+	
+	PHASE_TRACE_BEGIN(PHASE_TRACE_LOGIC);
+	bool snake_grew = Game_Step();
+	bool collision = Check_Collision();
+	EVENT_TRACE(collision ? EVENT_TRACE_COLLISION : EVENT_TRACE_MOVE, current_direction, snake_head);
+	if (snake_grew)
+	{
+		EVENT_TRACE(EVENT_TRACE_GROW, 0, snake_length);
+		EVENT_TRACE(EVENT_TRACE_FOOD, 0, food);
+	}
+	Save_State_Tick(current_direction);
+	PHASE_TRACE_END(PHASE_TRACE_LOGIC);
+	
+	if (collision)
+	{
+		if (render_mode == RENDER_MODE_BINARY)
+		{
+			Protocol_Send_Game_Over();
+		}
+		Game_Timer_Stop();
+		Save_State_End();
+		Display_Move_Below_Board();
+		UART0_Output_String("\nGAME OVER! Collision hit!");
+		UART0_Output_Newline();
+		UART0_Output_String("Your final score is ");
+		UART0_Output_Unsigned_Decimal(game_score);
+		UART0_Output_String(" points.");
+		UART0_Output_Newline();
+		High_Scores_Print(High_Scores_Submit(game_score));
+		Input_Report_Latency();
+		Game_Timer_Report_Jitter();
+		Low_Power_Report();
+		return STATE_GAME_OVER;
+	}
+	
+	// When the user fills the board
+	if (Game_Won())
+	{
+		if (render_mode == RENDER_MODE_BINARY)
+		{
+			Protocol_Send_Game_Over();
+		}
+		Game_Timer_Stop();
+		Save_State_End();
+		UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
+		UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
+		
+		UART0_Output_Newline();
+		UART0_Output_String("CONGRATULATIONS! You won the UART Snake Game!");
+		UART0_Output_Newline();
+		UART0_Output_String("Final Score: ");
+		UART0_Output_Unsigned_Decimal(game_score);
+		UART0_Output_Newline();
+		High_Scores_Print(High_Scores_Submit(game_score));
+		Input_Report_Latency();
+		Game_Timer_Report_Jitter();
+		Low_Power_Report();
+		return STATE_GAME_OVER;
+	}
+	
+	// Game display
+	PHASE_TRACE_BEGIN(PHASE_TRACE_RENDER);
+	Draw_Frame(snake_delay_ms, snake_grew);
+	PHASE_TRACE_END(PHASE_TRACE_RENDER);
+	
+	Record_Tick_Work(tick_start_cycles);
+	
+	// The length of the next tick carries the fraction of a cycle left over by this one
+	PHASE_TRACE_BEGIN(PHASE_TRACE_DELAY);
+	Game_Timer_Set_Period(Difficulty_Tick_Cycles(snake_period));
+	return STATE_GAME;
+}
+
+static void Multi_Game_Enter(void)
+{
+	UART0_Output_String("\x1B[2J"); // Clears TeraTerm screen
+	UART0_Output_String("\x1B[H"); // Place cursor on top left before printing
+	
+	Multi_Snake_Init(multi_game_snakes, multi_game_players);
+	Display_Reset();
+	Input_Queue_Init();
+	game_tick = 0;
+	Low_Power_Reset_Stats();
+	
+	Game_Start_Ticks();
+}
+
+static Game_State Multi_Game_Update(void)
+{
+	if (!Game_Timer_Take_Tick())
+	{
+		return STATE_MULTI_GAME;
+	}
+	PHASE_TRACE_END(PHASE_TRACE_DELAY);
+	
+	uint32_t tick_start_cycles = PROFILER_CYCLES();
+	
+	// The keys of both players share the Input_Queue, so every key that arrived since the last tick is applied
+	PHASE_TRACE_BEGIN(PHASE_TRACE_INPUT);
+	Input_Event event;
+	bool quit_game = false;
+	while (Input_Queue_Pop(&event))
+	{
+		char input = Input_Key(&event);
+		if (Multi_Snake_Key(input))
+		{
+			Input_Record_Latency(&event);
+		}
+		else if (input == 'Q' || input == 'q')
+		{
+			quit_game = true;
+		}
+	}
+	PHASE_TRACE_END(PHASE_TRACE_INPUT);
+	
+	PHASE_TRACE_BEGIN(PHASE_TRACE_LOGIC);
+	uint8_t crashed = Multi_Snake_Step();
+	PHASE_TRACE_END(PHASE_TRACE_LOGIC);
+	
+	// The cells of a snake that crashed are only known to the grid, so the board is drawn again
+	PHASE_TRACE_BEGIN(PHASE_TRACE_RENDER);
+	if (crashed)
+	{
+		Display_Reset();
+	}
+	Draw_Frame(snake_delay_ms, false);
+	PHASE_TRACE_END(PHASE_TRACE_RENDER);
+	
+	if (quit_game || !Multi_Snake_Playing())
+	{
+		Game_Timer_Stop();
+		Display_Move_Below_Board();
+		UART0_Output_String(quit_game ? "\nGame stopped." : "\nGAME OVER!");
+		UART0_Output_Newline();
+		Multi_Snake_Report();
+		Input_Report_Latency();
+		Low_Power_Report();
+		return STATE_GAME_OVER;
+	}
+	
+	// The telemetry records the head and direction of the first snake, and the total score
+	snake_head = multi_snake_head[0];
+	current_direction = multi_snake_direction[0];
+	Record_Tick_Work(tick_start_cycles);
+	
+	PHASE_TRACE_BEGIN(PHASE_TRACE_DELAY);
+	Game_Timer_Set_Period(Difficulty_Tick_Cycles(snake_period));
+	return STATE_MULTI_GAME;
+}
+
+static Game_State Game_Over_Update(void)
+{
+	Input_Event event;
+	while (Input_Queue_Pop(&event));
+	
+	return Timer_Expired() ? STATE_PLAY_AGAIN : STATE_GAME_OVER;
+}
+
+static Game_State Play_Again_Update(void)
+{
+	Input_Event event;
+	if (!Input_Queue_Pop(&event) || event.source != INPUT_SOURCE_UART)
+	{
+		return STATE_PLAY_AGAIN;
+	}
+	
+	switch (Play_Again_Key(event.key))
+	{
+		case PLAY_AGAIN_YES:
+		{
+			return STATE_TITLE;
+		}
+		case PLAY_AGAIN_NO:
 		{
 			UART0_Output_Newline();
 			UART0_Output_String("\nThank you for playing! Exiting Snake Game...");
+			return STATE_EXIT;
+		}
+		default:
+		{
+			return STATE_PLAY_AGAIN;
+		}
+	}
+}
+
+// Checks if the handler of the state has something to do; called with the interrupts disabled
+static bool State_Ready(Game_State state)
+{
+	// Save_State_Poll cannot sleep while it waits for the EEPROM, which has no interrupt here
+	if (Save_State_Busy())
+	{
+		return true;
+	}
+	
+	if (state == STATE_GAME)
+	{
+		// Keys wait in the Input_Queue for the next tick, unless the console reads them
+		return Debug_Console_Active() ? Input_Queue_Pending() : Game_Timer_Tick_Pending();
+	}
+	if (state == STATE_MULTI_GAME)
+	{
+		return Game_Timer_Tick_Pending();
+	}
+	
+	// High_Scores_Poll cannot sleep either, and is only called outside of a game
+	if (High_Scores_Busy())
+	{
+		return true;
+	}
+	return Input_Queue_Pending() || (timer_running && Timer_Remaining_Cycles() == 0);
+}
+
+static void Enter_State(Game_State state)
+{
+	// Each state starts the state timer again if it uses it
+	timer_running = false;
+	
+	switch (state)
+	{
+		case STATE_TITLE:
+		{
+			Title_Screen_Enter();
+			break;
+		}
+		case STATE_ATTRACT:
+		{
+			Attract_Mode_Start();
+			Timer_Start(ATTRACT_MODE_TICK_MS);
+			break;
+		}
+		case STATE_GAME:
+		{
+			Game_Screen_Enter();
+			break;
+		}
+		case STATE_MULTI_GAME:
+		{
+			Multi_Game_Enter();
 			break;
 		}
+		case STATE_GAME_OVER:
+		{
+			Timer_Start(GAME_OVER_HOLD_MS);
+			break;
+		}
+		case STATE_PLAY_AGAIN:
+		{
+			Play_Again_Prompt();
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+}
+
+// Sets up the modules that the title screen does not need
+static void Boot_Init_Peripherals(void)
+{
+	Phase_Trace_Init();
+	Status_LEDs_Init();
+	Telemetry_Init();
+	Game_Timer_Init();
+	Low_Power_Init();
+	Boot_Profile_Stamp(BOOT_STAGE_PERIPHERALS);
+	
+	// The high score table is loaded from the EEPROM while the title screen waits for a key
+	High_Scores_Init();
+	Boot_Profile_Stamp(BOOT_STAGE_EEPROM);
+}
+
+// Picks the cheapest renderer that the terminal supports
+static void Boot_Probe_Terminal(void)
+{
+	terminal_render_mode = Terminal_Probe();
+	Boot_Profile_Stamp(BOOT_STAGE_PROBE);
+}
+
+// From now on, the keyboard and the EduBase buttons are read from the Input_Queue
+static void Boot_Init_Input(void)
+{
+	Input_Queue_Init();
+	UART0_Enable_Receive_Interrupt();
+	EduBase_Button_Interrupt_Init();
+	Boot_Profile_Stamp(BOOT_STAGE_INPUT);
+}
+
+int main(void)
+{
+	Boot_Profile_Start();
+	UART0_Init();
+	Profiler_Init();
+	Boot_Profile_Stamp(BOOT_STAGE_UART);
+	
+	Game_State state = STATE_TITLE;
+#if FAST_BOOT
+	// The title screen is sent first, and the other modules are set up while it is on the wire
+	Boot_Profile_Stamp(BOOT_STAGE_FIRST_BYTE);
+	Enter_State(state);
+	Boot_Profile_Stamp(BOOT_STAGE_TITLE);
+	Boot_Init_Peripherals();
+	
+	// The replies of the terminal would wait behind the title screen, so the probe waits for it
+	while (!UART0_Transmit_Idle());
+	Boot_Probe_Terminal();
+	
+	// The probe draws on the line of the prompt, which is written again
+	UART0_Output_Character(UART0_CR);
+	UART0_Output_String("Press the SPACEBAR to start the Snake Game! ");
+	Title_Screen_Wait();
+	Boot_Init_Input();
+#else
+	// The first byte is the start of the terminal probe
+	Boot_Profile_Stamp(BOOT_STAGE_FIRST_BYTE);
+	Boot_Probe_Terminal();
+	Boot_Init_Input();
+	Boot_Init_Peripherals();
+	Enter_State(state);
+	Boot_Profile_Stamp(BOOT_STAGE_TITLE);
+#endif
+	
+	while (state != STATE_EXIT)
+	{
+		// The high score table is loaded or saved one EEPROM word at a time, except during a game
+		if (state != STATE_GAME && state != STATE_MULTI_GAME)
+		{
+			High_Scores_Poll();
+		}
+		
+		// The running game is saved one EEPROM word at a time, also after it is suspended
+		Save_State_Poll();
+		
+		Game_State next_state = state;
+		switch (state)
+		{
+			case STATE_TITLE:
+			{
+				next_state = Title_Screen_Update();
+				break;
+			}
+			case STATE_ATTRACT:
+			{
+				next_state = Attract_Mode_Update();
+				break;
+			}
+			case STATE_GAME:
+			{
+				next_state = Game_Screen_Update();
+				break;
+			}
+			case STATE_MULTI_GAME:
+			{
+				next_state = Multi_Game_Update();
+				break;
+			}
+			case STATE_GAME_OVER:
+			{
+				next_state = Game_Over_Update();
+				break;
+			}
+			case STATE_PLAY_AGAIN:
+			{
+				next_state = Play_Again_Update();
+				break;
+			}
+			default:
+			{
+				break;
+			}
+		}
+		
+		if (next_state != state)
+		{
+			state = next_state;
+			Enter_State(state);
+		}
+		
+		// An interrupt between the check and the WFI instruction still wakes the core, since the
+		// interrupts are only masked in the core, and its handler runs once they are unmasked again
+		__disable_irq();
+		if (state != STATE_EXIT && !State_Ready(state))
+		{
+			Low_Power_Sleep(timer_running ? Timer_Remaining_Cycles() : LOW_POWER_MAX_SLEEP_CYCLES);
+		}
+		__enable_irq();
 	}
 	return 0;
 }